@@ -105,7 +105,7 @@ char string_off[] = "OFF";
 
 /*
  * Variable 'analogValue' is later configured to be printed on the display.
- * This time a static variable is used for holding the previous analog value.
+ * Its line is redrawn periodically by the menu.
  */
 const byte analogPin = A5;
 unsigned short analogValue = 0;
@@ -162,6 +162,12 @@ void setup() {
 	pwm_line.attach_function(1, pwm_up);
 	pwm_line.attach_function(2, pwm_down);
 
+	// The analog reading is redrawn every 500 milliseconds. It's printed
+	// right aligned in 4 columns so that a shorter value replaces a longer
+	// one in place.
+	analog_line.set_refreshPeriod(500);
+	analog_line.set_fieldWidth(2, 4, Align::RIGHT);
+
 	menu.add_screen(welcome_screen);
 	menu.add_screen(screen2);
 	menu.add_screen(pwm_screen);
@@ -211,21 +217,20 @@ void loop() {
 			// Changes the text that is printed on the display.
 			strncpy(ledState_text, string_on, sizeof(string_on));
 			Serial.println(ledState_text);
-			menu.update();
+			// Only the changed line is sent to the display.
+			menu.refresh_line(ledState_line);
 		} else {
 			ledState = LOW;
 			strncpy(ledState_text, string_off, sizeof(string_off));
 			Serial.println(ledState_text);
-			menu.update();
+			menu.refresh_line(ledState_line);
 		}
 		digitalWrite(ledPin, ledState);
-
-		// The 'analogValue' is updated every second.
-		analogValue = analogRead(analogPin);
-		static unsigned short lastAnalogValue = 0;
-		if (analogValue != lastAnalogValue) {
-			lastAnalogValue = analogValue;
-			menu.update();
-		}
 	}
+
+	// The 'analogValue' is read on every loop and its line is redrawn
+	// by 'tick()' at its refresh period. Nothing is sent if the line isn't
+	// on the current screen or its characters didn't change.
+	analogValue = analogRead(analogPin);
+	menu.tick(millis());
 }
@@ -134,6 +134,14 @@ void setup() {
   lcd.createChar(fan_glyphIndex + 1, glyphs::fan2);
   lcd.createChar(thermometer_glyphIndex, glyphs::thermometer);
   lcd.createChar(celsiusSymbol_glyphIndex, glyphs::celsiusSymbol);
+  // The menu uploads its own glyphs (e.g. the focus indicator) to the
+  // free slots, these slots are reserved so that it doesn't replace the
+  // glyphs created above. The second fan glyph isn't printed until the
+  // animation switches to it.
+  menu.reserve_glyphSlot(fan_glyphIndex);
+  menu.reserve_glyphSlot(fan_glyphIndex + 1);
+  menu.reserve_glyphSlot(thermometer_glyphIndex);
+  menu.reserve_glyphSlot(celsiusSymbol_glyphIndex);
 
   // This functions tells the LiquidLine objects that their first
   // variable is not an integer value but an index to a glyph.
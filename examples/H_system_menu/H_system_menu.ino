@@ -251,6 +251,13 @@ void setup() {
   iSample_line.attach_function(increase, increase_samplePeriod);
   iSample_line.attach_function(decrease, decrease_samplePeriod);
 
+  // The variables and functions that didn't fit in the line slots are
+  // counted, raise MAX_LINE_SLOTS in LiquidMenu_config.h if any are missing.
+  if (LiquidLineBase::get_missingSlots() > 0) {
+    Serial.print(F("Missing line slots: "));
+    Serial.println(LiquidLineBase::get_missingSlots());
+  }
+
   strncpy(input_saved, string_saved, sizeof(string_saved));
   strncpy(output_saved, string_saved, sizeof(string_saved));
 
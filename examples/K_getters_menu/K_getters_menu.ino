@@ -49,9 +49,6 @@ LiquidCrystal lcd(LCD_RS, LCD_E, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
 
 const byte potPin = A1;
 
-unsigned long updatePeriod = 500;
-unsigned long updateLastMs = 0;
-
 // This is the first getter function, it reads the potentiometer value.
 int readPot() {
   return analogRead(potPin);
@@ -98,6 +95,12 @@ void setup() {
   menu.add_screen(welcome_screen);
   menu.add_screen(pot_screen);
 
+  // The getters' values are kept, `refresh_getters()` redraws the lines
+  // only when they change. The getters are called at most every 100
+  // milliseconds, in between their last values are printed.
+  potValue_line.set_getterInterval(100);
+  potPosition_line.set_getterInterval(100);
+
   // Display the welcome screen as a splash screen.
   menu.update();
   delay(1000);
@@ -108,9 +111,6 @@ void setup() {
 }
 
 void loop() {
-  if (millis() - updateLastMs > updatePeriod) {
-    updateLastMs = millis();
-
-    menu.update();
-  }
+  // Only the lines whose getters returned a new value are redrawn.
+  menu.refresh_getters();
 }
@@ -0,0 +1,244 @@
+/*
+ * LiquidMenu library - benchmark_menu.ino
+ *
+ * This example measures how long the menu operations take and how
+ * many commands they send to the display.
+ *
+ * It builds menus similar to the ones from the other examples and
+ * repeats every operation (update, softUpdate, next_screen,
+ * switch_focus and call_function) a number of times. The average
+ * duration and amount of characters, cursor positionings and clears
+ * per operation are printed to the serial monitor, the counts are
+ * taken from the menu's rendering statistics (`get_stats()`). The
+ * durations include both the time spent in the menu and the time spent
+ * waiting for the display. The display doesn't need to be connected,
+ * the LiquidCrystal library doesn't read from it (R/W pin to ground)
+ * and waits the same amount of time either way. Use this sketch to
+ * compare the cost of the different ways of updating the display and
+ * to find regressions in the library. At the end the library's number
+ * formatting is compared to the one of the Print class.
+ *
+ * The circuit:
+ * https://raw.githubusercontent.com/VasilKalchev/LiquidMenu/master/examples/A_hello_menu/hello_menu.png
+ * - LCD RS pin to Arduino pin 12
+ * - LCD E pin to Arduino pin 11
+ * - LCD D4 pin to Arduino pin 5
+ * - LCD D5 pin to Arduino pin 4
+ * - LCD D6 pin to Arduino pin 3
+ * - LCD D7 pin to Arduino pin 2
+ * - LCD R/W pin to ground
+ * - LCD VSS pin to ground
+ * - LCD VDD pin to 5V
+ * - 10k ohm potentiometer: ends to 5V and ground, wiper to LCD V0
+ * - 150 ohm resistor from 5V to LCD Anode
+ * - LCD Cathode to ground
+ *
+ * https://github.com/VasilKalchev/LiquidMenu
+ *
+ */
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+// Pin mapping for the display
+const byte LCD_RS = 12;
+const byte LCD_E = 11;
+const byte LCD_D4 = 5;
+const byte LCD_D5 = 4;
+const byte LCD_D6 = 3;
+const byte LCD_D7 = 2;
+//LCD R/W pin to ground
+//10K potentiometer wiper to VO
+
+LiquidCrystal lcd(LCD_RS, LCD_E, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
+
+// How many times every operation is repeated.
+const byte repetitions = 20;
+
+unsigned short analogValue = 512;
+char ledState_text[4] = "OFF";
+byte pwmLevel = 0;
+
+// Screens similar to the "buttons_menu" example.
+LiquidLine welcome_line1(1, 0, "LiquidMenu ", LIQUIDMENU_VERSION);
+LiquidLine welcome_line2(0, 1, "Benchmark");
+LiquidScreen welcome_screen(welcome_line1, welcome_line2);
+
+LiquidLine analog_line(0, 0, "Analog: ", analogValue);
+LiquidLine ledState_line(0, 1, "LED is ", ledState_text);
+LiquidScreen status_screen(analog_line, ledState_line);
+
+LiquidLine pwm_line(0, 0, "PWM level: ", pwmLevel);
+LiquidScreen pwm_screen(pwm_line);
+
+// A screen similar to the "scrolling_menu" example.
+const float pi = 3.14159265f;
+LiquidLine pi_line(0, 0, pi);
+LiquidLine line2(0, 1, "Line 2");
+LiquidLine line3(0, 1, "Line 3");
+LiquidLine line4(0, 1, "Line 4");
+LiquidScreen scrolling_screen;
+
+LiquidMenu menu(lcd, welcome_screen, status_screen, pwm_screen);
+
+void pwm_up() {
+  pwmLevel += 25;
+}
+
+void blankFunction() {
+  return;
+}
+
+// The measured operations.
+void op_update() {
+  menu.update();
+}
+
+void op_softUpdate() {
+  analogValue++;
+  menu.softUpdate();
+}
+
+void op_nextScreen() {
+  menu.next_screen();
+}
+
+void op_switchFocus() {
+  menu.switch_focus();
+}
+
+void op_callFunction() {
+  menu.call_function(1);
+}
+
+// Repeats an operation and prints its average duration and display commands.
+void measure(const __FlashStringHelper *name, void (*operation)()) {
+  menu.reset_stats();
+  unsigned long start = micros();
+  for (byte i = 0; i < repetitions; i++) {
+    operation();
+  }
+  unsigned long duration = micros() - start;
+  const LiquidStats &stats = menu.get_stats();
+
+  Serial.print(name);
+  Serial.print(F("\t"));
+  Serial.print(duration / repetitions);
+  Serial.print(F(" us\t"));
+  Serial.print(stats.characters / repetitions);
+  Serial.print(F(" chars\t"));
+  Serial.print(stats.cursorMoves / repetitions);
+  Serial.print(F(" cursor\t"));
+  Serial.print(stats.clears / repetitions);
+  Serial.print(F(" clears\tmax render "));
+  Serial.print(stats.maxRenderUs);
+  Serial.println(F(" us"));
+}
+
+// Runs all of the operations in the current mode of the menu.
+void measureAll() {
+  menu.change_screen(&status_screen);
+  measure(F("update       "), op_update);
+  measure(F("softUpdate   "), op_softUpdate);
+  measure(F("next_screen  "), op_nextScreen);
+
+  menu.change_screen(&pwm_screen);
+  measure(F("switch_focus "), op_switchFocus);
+  menu.set_focusedLine(0);
+  measure(F("call_function"), op_callFunction);
+
+  menu.change_screen(&scrolling_screen);
+  measure(F("scroll focus "), op_switchFocus);
+}
+
+// The frame used for measuring the number formatting.
+LiquidFrame frame;
+unsigned long longValue = 3141592UL;
+
+// The measured number formatting, with Print and with the library.
+void fmt_printShort() {
+  frame.print(analogValue);
+}
+
+void fmt_libraryShort() {
+  frame.print_unsigned(analogValue);
+}
+
+void fmt_printLong() {
+  frame.print(longValue);
+}
+
+void fmt_libraryLong() {
+  frame.print_unsigned(longValue);
+}
+
+void fmt_printFloat() {
+  frame.print(pi, 2);
+}
+
+void fmt_libraryFloat() {
+  frame.print_float(pi, 2);
+}
+
+// Returns the average duration of formatting a number in microseconds.
+unsigned long formatDuration(void (*format)()) {
+  unsigned long start = micros();
+  for (byte i = 0; i < repetitions; i++) {
+    frame.setCursor(0, 0);
+    format();
+  }
+  return (micros() - start) / repetitions;
+}
+
+// Prints the duration of formatting a number with Print and with the library.
+void measureFormat(const __FlashStringHelper *name,
+                   void (*printFormat)(), void (*libraryFormat)()) {
+  Serial.print(name);
+  Serial.print(F("\tPrint "));
+  Serial.print(formatDuration(printFormat));
+  Serial.print(F(" us\tLiquidMenu "));
+  Serial.print(formatDuration(libraryFormat));
+  Serial.println(F(" us"));
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  lcd.begin(16, 2);
+  // The menu follows the display's cursor from one row to the next and
+  // doesn't send the characters which don't fit on it.
+  menu.set_displaySize(16, 2);
+
+  scrolling_screen.add_line(pi_line);
+  scrolling_screen.add_line(line2);
+  scrolling_screen.add_line(line3);
+  scrolling_screen.add_line(line4);
+  scrolling_screen.set_displayLineCount(2);
+  pi_line.attach_function(1, blankFunction);
+  line2.attach_function(1, blankFunction);
+  line3.attach_function(1, blankFunction);
+  line4.attach_function(1, blankFunction);
+  menu.add_screen(scrolling_screen);
+
+  pwm_line.attach_function(1, pwm_up);
+
+  Serial.print(F("LiquidMenu ")); Serial.print(LIQUIDMENU_VERSION);
+  Serial.println(F(" - Benchmark example:"));
+
+  Serial.println(F("\nClearing the display on update:"));
+  menu.set_clearOnUpdate(true);
+  measureAll();
+
+  Serial.println(F("\nOverwriting the display on update:"));
+  menu.set_clearOnUpdate(false);
+  measureAll();
+
+  Serial.println(F("\nFormatting numbers:"));
+  measureFormat(F("uint16_t     "), fmt_printShort, fmt_libraryShort);
+  measureFormat(F("uint32_t     "), fmt_printLong, fmt_libraryLong);
+  measureFormat(F("float        "), fmt_printFloat, fmt_libraryFloat);
+}
+
+void loop() {
+
+}
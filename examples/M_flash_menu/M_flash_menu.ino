@@ -0,0 +1,188 @@
+/*
+ * LiquidMenu library - flash_menu.ino
+ *
+ * This example demonstrates how to define the whole menu as
+ * constant data in flash memory.
+ *
+ * It is the buttons_menu example with the lines, screens and the menu
+ * defined as 'constexpr' arrays stored in flash memory (PROGMEM).
+ * Only the state of the menu (current screen, focused line, hidden
+ * screens) is kept in RAM and nothing is built in 'setup()', the text
+ * of the lines is declared 'PROGMEM' as well. The variables printed on
+ * the display and the callback functions are the same as in the
+ * buttons_menu example.
+ *
+ * The circuit:
+ * https://raw.githubusercontent.com/VasilKalchev/LiquidMenu/master/examples/D_buttons_menu/buttons_menu.png
+ * - LCD RS pin to Arduino pin 12
+ * - LCD E pin to Arduino pin 11
+ * - LCD D4 pin to Arduino pin 5
+ * - LCD D5 pin to Arduino pin 4
+ * - LCD D6 pin to Arduino pin 3
+ * - LCD D7 pin to Arduino pin 2
+ * - LCD R/W pin to ground
+ * - LCD VSS pin to ground
+ * - LCD VDD pin to 5V
+ * - 10k ohm potentiometer: ends to 5V and ground, wiper to LCD V0
+ * - 150 ohm resistor from 5V to LCD Anode
+ * - LCD Cathode to ground
+ * - ----
+ * - Button (left) to Arduino pin A0 and ground
+ * - Button (right) to Arduino pin 7 and ground
+ * - Button (up) to Arduino pin 8 and ground
+ * - Button (down) to Arduino pin 9 and ground
+ * - Button (enter) to Arduino pin 10 and ground
+ * - A PWM controlled device (LED...) to Arduino pin 6
+ * - some analog input to Arduino pin A5 (unconnected also works)
+ *
+ * https://github.com/VasilKalchev/LiquidMenu
+ *
+ */
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+#include "Button.h"
+
+// Pin mapping for the display
+const byte LCD_RS = 12;
+const byte LCD_E = 11;
+const byte LCD_D4 = 5;
+const byte LCD_D5 = 4;
+const byte LCD_D6 = 3;
+const byte LCD_D7 = 2;
+//LCD R/W pin to ground
+//10K potentiometer to VO
+LiquidCrystal lcd(LCD_RS, LCD_E, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
+
+// Button objects instantiation
+const bool pullup = true;
+Button left(A0, pullup);
+Button right(7, pullup);
+Button up(8, pullup);
+Button down(9, pullup);
+Button enter(10, pullup);
+
+const byte pwmPin = 6;
+byte pwmLevel = 0;
+
+const byte analogPin = A5;
+unsigned short analogValue = 0;
+
+// Functions to be attached to the PWM line.
+void pwm_up() {
+	if (pwmLevel < 225) {
+		pwmLevel += 25;
+	} else {
+		pwmLevel = 250;
+	}
+	analogWrite(pwmPin, pwmLevel);
+}
+
+void pwm_down() {
+	if (pwmLevel > 25) {
+		pwmLevel -= 25;
+	} else {
+		pwmLevel = 0;
+	}
+	analogWrite(pwmPin, pwmLevel);
+}
+
+/*
+ * The text of the lines is stored in flash memory too. String literals
+ * would be copied to RAM at startup, so they aren't accepted by
+ * 'LiquidVariableDef', the text is declared 'PROGMEM' and passed through
+ * 'as_progmem()'.
+ */
+const char liquidMenu_text[] PROGMEM = "LiquidMenu";
+const char flashExample_text[] PROGMEM = "Flash example";
+const char analog_text[] PROGMEM = "Analog: ";
+const char pwmLevel_text[] PROGMEM = "PWM level: ";
+
+/*
+ * The variables of every line are listed in a 'LiquidVariableDef' array.
+ * Their data types are recognized at compile time, they are the same as
+ * the ones accepted by the 'LiquidLine' objects.
+ */
+constexpr LiquidVariableDef welcome_variables1[] PROGMEM = {
+	as_progmem(liquidMenu_text)
+};
+constexpr LiquidVariableDef welcome_variables2[] PROGMEM = {
+	as_progmem(flashExample_text)
+};
+constexpr LiquidVariableDef analog_variables[] PROGMEM = {
+	as_progmem(analog_text), analogValue
+};
+constexpr LiquidVariableDef pwm_variables[] PROGMEM = {
+	as_progmem(pwmLevel_text), pwmLevel
+};
+
+/*
+ * The functions of a line are listed with their numbers, the same ones
+ * used with 'LiquidLine::attach_function()'.
+ */
+constexpr LiquidFunctionDef pwm_functions[] PROGMEM = {
+	{1, pwm_up},
+	{2, pwm_down}
+};
+
+// The lines of every screen.
+constexpr LiquidLineDef welcome_lines[] PROGMEM = {
+	make_liquidLineDef(1, 0, welcome_variables1),
+	make_liquidLineDef(1, 1, welcome_variables2)
+};
+constexpr LiquidLineDef analog_lines[] PROGMEM = {
+	make_liquidLineDef(0, 0, analog_variables)
+};
+constexpr LiquidLineDef pwm_lines[] PROGMEM = {
+	make_liquidLineDef(0, 0, pwm_variables, pwm_functions)
+};
+
+// The screens of the menu.
+constexpr LiquidScreenDef menu_screens[] PROGMEM = {
+	make_liquidScreenDef(welcome_lines),
+	make_liquidScreenDef(analog_lines),
+	make_liquidScreenDef(pwm_lines)
+};
+
+// The menu keeps only the state of its three screens in RAM.
+LiquidFlashMenu<3> menu(lcd, menu_screens);
+
+void setup() {
+	Serial.begin(250000);
+
+	pinMode(analogPin, INPUT);
+	pinMode(pwmPin, OUTPUT);
+
+	lcd.begin(16, 2);
+
+	menu.update();
+}
+
+void loop() {
+	if (right.check() == LOW) {
+		menu.next_screen();
+	}
+	if (left.check() == LOW) {
+		menu.previous_screen();
+	}
+	if (up.check() == LOW) {
+		menu.call_function(1);
+	}
+	if (down.check() == LOW) {
+		menu.call_function(2);
+	}
+	if (enter.check() == LOW) {
+		menu.switch_focus();
+	}
+
+	static unsigned long lastMillis = 0;
+	if (millis() - lastMillis > 1000) {
+		lastMillis = millis();
+
+		unsigned short lastAnalogValue = analogValue;
+		analogValue = analogRead(analogPin);
+		if (analogValue != lastAnalogValue) {
+			menu.update();
+		}
+	}
+}
@@ -0,0 +1,132 @@
+/*
+ * LiquidMenu library - list_menu.ino
+ *
+ * This example demonstrates how to show a long list of items on
+ * a screen without a LiquidLine object for every item.
+ *
+ * A LiquidListScreen is given the number of items and a function
+ * that prints one item. Only the visible items are printed and the
+ * screen scrolls to keep the focused item on the display, so a list
+ * of 200 channels takes as much RAM as a screen with one line. Use
+ * the "up" and "down" buttons to move the focus through the channels
+ * and the "enter" button to select the focused channel. The "left"
+ * and "right" buttons change the screen.
+ *
+ * The circuit:
+ * https://raw.githubusercontent.com/VasilKalchev/LiquidMenu/master/examples/D_buttons_menu/buttons_menu.png
+ * - LCD RS pin to Arduino pin 12
+ * - LCD E pin to Arduino pin 11
+ * - LCD D4 pin to Arduino pin 5
+ * - LCD D5 pin to Arduino pin 4
+ * - LCD D6 pin to Arduino pin 3
+ * - LCD D7 pin to Arduino pin 2
+ * - LCD R/W pin to ground
+ * - LCD VSS pin to ground
+ * - LCD VDD pin to 5V
+ * - 10k ohm potentiometer: ends to 5V and ground, wiper to LCD V0
+ * - 150 ohm resistor from 5V to LCD Anode
+ * - LCD Cathode to ground
+ * - ----
+ * - Button (left) to Arduino pin A0 and ground
+ * - Button (right) to Arduino pin 7 and ground
+ * - Button (up) to Arduino pin 8 and ground
+ * - Button (down) to Arduino pin 9 and ground
+ * - Button (enter) to Arduino pin 10 and ground
+ *
+ * https://github.com/VasilKalchev/LiquidMenu
+ *
+ */
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+#include "Button.h"
+
+// Pin mapping for the display
+const byte LCD_RS = 12;
+const byte LCD_E = 11;
+const byte LCD_D4 = 5;
+const byte LCD_D5 = 4;
+const byte LCD_D6 = 3;
+const byte LCD_D7 = 2;
+//LCD R/W pin to ground
+//10K potentiometer to VO
+LiquidCrystal lcd(LCD_RS, LCD_E, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
+
+// Button objects instantiation
+const bool pullup = true;
+Button left(A0, pullup);
+Button right(7, pullup);
+Button up(8, pullup);
+Button down(9, pullup);
+Button enter(10, pullup);
+
+const uint16_t channelCount = 200;
+uint16_t selectedChannel = 0;
+
+// Prints one item of the list.
+/*
+ * It's called for every visible row with the index of the item
+ * that is shown on it. The text is printed into the menu's buffer
+ * and sent to the display with the rest of the screen.
+ */
+void print_channel(uint16_t index, Print &output) {
+	output.print(F("Channel "));
+	output.print(index + 1);
+	if (index == selectedChannel) {
+		output.print(F(" *"));
+	}
+}
+
+LiquidListScreen channel_screen(print_channel, channelCount, 2, 1);
+
+LiquidLine selected_line(0, 0, "Selected: ", selectedChannel);
+LiquidLine hint_line(0, 1, "Press right");
+LiquidScreen selected_screen(selected_line, hint_line);
+
+LiquidMenu menu(lcd, channel_screen, selected_screen);
+
+// Function to be attached to the list.
+/*
+ * The list has one set of functions for all of its items,
+ * 'get_focusedItem()' tells which item is focused.
+ */
+void select_channel() {
+	selectedChannel = channel_screen.get_focusedItem();
+}
+
+void setup() {
+	Serial.begin(250000);
+
+	lcd.begin(16, 2);
+
+	channel_screen.attach_function(1, select_channel);
+	channel_screen.set_focusedItem(0);
+
+	menu.update();
+}
+
+void loop() {
+	if (right.check() == LOW) {
+		Serial.println(F("RIGHT button pressed"));
+		menu.next_screen();
+	}
+	if (left.check() == LOW) {
+		Serial.println(F("LEFT button pressed"));
+		menu.previous_screen();
+	}
+	if (up.check() == LOW) {
+		Serial.println(F("UP button pressed"));
+		// Moves the focus to the previous channel, the list
+		// scrolls when the focus leaves the display.
+		menu.switch_focus(false);
+	}
+	if (down.check() == LOW) {
+		Serial.println(F("DOWN button pressed"));
+		menu.switch_focus(true);
+	}
+	if (enter.check() == LOW) {
+		Serial.println(F("ENTER button pressed"));
+		menu.call_function(1);
+		menu.update();
+	}
+}
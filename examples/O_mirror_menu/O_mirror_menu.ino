@@ -0,0 +1,101 @@
+/*
+ * LiquidMenu library - mirror_menu.ino
+ *
+ * This example demonstrates how to show one menu on two displays.
+ *
+ * The menu is shown on a front and a rear display. The screens are
+ * printed once and every display is sent only the characters that
+ * changed on it. The two displays share the data pins and have
+ * separate enable pins. Use the "left" and "right" buttons to change
+ * the screen, both displays follow.
+ *
+ * The circuit:
+ * https://raw.githubusercontent.com/VasilKalchev/LiquidMenu/master/examples/D_buttons_menu/buttons_menu.png
+ * - both LCDs' RS pins to Arduino pin 12
+ * - front LCD E pin to Arduino pin 11
+ * - rear LCD E pin to Arduino pin 6
+ * - both LCDs' D4 pins to Arduino pin 5
+ * - both LCDs' D5 pins to Arduino pin 4
+ * - both LCDs' D6 pins to Arduino pin 3
+ * - both LCDs' D7 pins to Arduino pin 2
+ * - both LCDs' R/W pins to ground
+ * - both LCDs' VSS pins to ground
+ * - both LCDs' VDD pins to 5V
+ * - 10k ohm potentiometer: ends to 5V and ground, wiper to the LCDs' V0
+ * - 150 ohm resistors from 5V to the LCDs' Anodes
+ * - both LCDs' Cathodes to ground
+ * - ----
+ * - Button (left) to Arduino pin A0 and ground
+ * - Button (right) to Arduino pin 7 and ground
+ * - some analog input to Arduino pin A5 (unconnected also works)
+ *
+ * https://github.com/VasilKalchev/LiquidMenu
+ *
+ */
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+#include "Button.h"
+
+// Pin mapping for the displays
+const byte LCD_RS = 12;
+const byte LCD_E_FRONT = 11;
+const byte LCD_E_REAR = 6;
+const byte LCD_D4 = 5;
+const byte LCD_D5 = 4;
+const byte LCD_D6 = 3;
+const byte LCD_D7 = 2;
+LiquidCrystal front_lcd(LCD_RS, LCD_E_FRONT, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
+LiquidCrystal rear_lcd(LCD_RS, LCD_E_REAR, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
+
+// Drives the rear display and keeps what it shows.
+LiquidTypedDriver<LiquidCrystal> rear_driver(rear_lcd);
+LiquidDisplay rear_display(rear_driver);
+
+// Button objects instantiation
+const bool pullup = true;
+Button left(A0, pullup);
+Button right(7, pullup);
+
+const byte analogPin = A5;
+unsigned short analogValue = 0;
+
+LiquidLine welcome_line1(1, 0, "LiquidMenu ", LIQUIDMENU_VERSION);
+LiquidLine welcome_line2(0, 1, "Mirror example");
+LiquidScreen welcome_screen(welcome_line1, welcome_line2);
+
+LiquidLine analog_line(0, 0, "Analog: ", analogValue);
+LiquidScreen analog_screen(analog_line);
+
+LiquidMenu menu(front_lcd, welcome_screen, analog_screen);
+
+void setup() {
+	Serial.begin(250000);
+
+	pinMode(analogPin, INPUT);
+
+	front_lcd.begin(16, 2);
+	rear_lcd.begin(16, 2);
+
+	// The rear display shows the same screens as the front one.
+	menu.add_display(rear_display);
+
+	analog_line.set_refreshPeriod(500);
+	analog_line.set_fieldWidth(2, 4, Align::RIGHT);
+
+	menu.update();
+}
+
+void loop() {
+	if (right.check() == LOW) {
+		Serial.println(F("RIGHT button pressed"));
+		menu.next_screen();
+	}
+	if (left.check() == LOW) {
+		Serial.println(F("LEFT button pressed"));
+		menu.previous_screen();
+	}
+
+	analogValue = analogRead(analogPin);
+	menu.tick(millis());
+}
@@ -0,0 +1,97 @@
+/*
+ * LiquidMenu library - pcf8574_menu.ino
+ *
+ * This is the "hello_menu" example for an I2C display driven by the
+ * library's own PCF8574 backend instead of a third-party library.
+ *
+ * LiquidPCF8574 sends the characters that the menu changes in bursts,
+ * as many as fit in the Wire library's buffer in one transmission. The
+ * display is used through a driver made with make_liquidDriver(), so
+ * "LiquidMenu_config.h" doesn't need to be changed. It can also be
+ * selected there as the DisplayClass.
+ *
+ * The circuit:
+ * https://raw.githubusercontent.com/VasilKalchev/LiquidMenu/master/examples/I_I2C_menu/I2C_menu.png
+ * - PCF8574 module SCL to Arduino pin A5
+ * - PCF8574 module SDA to Arduino pin A4
+ * - PCF8574 module VCC to Arduino 5V
+ * - PCF8574 module GND to Arduino GND
+ *
+ * https://github.com/VasilKalchev/LiquidMenu
+ *
+ */
+
+#include <Wire.h>
+// The menu wrapper library
+#include <LiquidMenu.h>
+// The library's own PCF8574 backend
+#include <LiquidPCF8574.h>
+
+// The I2C LCD object, 0x27 is the usual address of the modules (0x3F
+// for the ones with a PCF8574A).
+LiquidPCF8574 lcd(0x27);
+// The driver through which the menu sends the commands to the display.
+auto lcd_driver = make_liquidDriver(lcd);
+
+// The "A1" alias used in the wiring diagram above is an AVR (Uno,
+// Nano, ...) convention. On boards without it, e.g. ESP32, use any
+// ADC-capable GPIO instead.
+#if defined(ARDUINO_ARCH_AVR)
+const byte analogPin = A1;
+#else
+const byte analogPin = 34;
+#endif
+
+unsigned short analogReading = 0;
+unsigned short lastAnalogReading = 0;
+
+unsigned int period_check = 1000;
+unsigned long lastMs_check = 0;
+
+unsigned int period_nextScreen = 5000;
+unsigned long lastMs_nextScreen = 0;
+
+LiquidLine welcome_line1(1, 0, "LiquidMenu ", LIQUIDMENU_VERSION);
+LiquidLine welcome_line2(0, 1, "Hello PCF8574");
+LiquidScreen welcome_screen(welcome_line1, welcome_line2);
+
+LiquidLine analogReading_line(0, 0, "Analog: ", analogReading);
+LiquidScreen secondary_screen(analogReading_line);
+
+// The menu is given the driver instead of the display object.
+LiquidMenu menu(lcd_driver, welcome_screen, secondary_screen);
+
+
+void setup() {
+  Serial.begin(250000);
+
+  pinMode(analogPin, INPUT);
+
+  // The I2C bus is initialized before the display. The modules work up
+  // to 400 kHz, a faster clock sends the bursts faster.
+  Wire.begin();
+  Wire.setClock(400000);
+  lcd.begin(16, 2);
+
+  // Menu initialization.
+  menu.init();
+  menu.update();
+}
+
+void loop() {
+  // Periodic reading of the analog pin.
+  if (millis() - lastMs_check > period_check) {
+    lastMs_check = millis();
+    analogReading = analogRead(analogPin);
+    if (analogReading != lastAnalogReading) {
+      lastAnalogReading = analogReading;
+      menu.update();
+    }
+  }
+
+  // Periodic switching to the next screen.
+  if (millis() - lastMs_nextScreen > period_nextScreen) {
+    lastMs_nextScreen = millis();
+    menu.next_screen();
+  }
+}
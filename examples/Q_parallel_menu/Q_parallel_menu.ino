@@ -0,0 +1,110 @@
+/*
+ * LiquidMenu library - parallel_menu.ino
+ *
+ * This is the "hello_menu" example for a parallel display driven by the
+ * library's own LiquidParallel backend instead of LiquidCrystal.
+ *
+ * LiquidCrystal waits 100 microseconds after every half of a character.
+ * LiquidParallel waits before the next instruction and only for as long
+ * as the display needs. With the R/W pin of the display connected, the
+ * time is measured in begin() with the display's busy flag. With R/W
+ * connected to ground the longest time from the datasheet is used. The
+ * duration of the last render is printed to the serial monitor.
+ *
+ * The circuit:
+ * https://raw.githubusercontent.com/VasilKalchev/LiquidMenu/master/examples/A_hello_menu/hello_menu.png
+ * - LCD RS pin to Arduino pin 12
+ * - LCD E pin to Arduino pin 11
+ * - LCD D4 pin to Arduino pin 5
+ * - LCD D5 pin to Arduino pin 4
+ * - LCD D6 pin to Arduino pin 3
+ * - LCD D7 pin to Arduino pin 2
+ * - LCD R/W pin to Arduino pin 10 (instead of ground)
+ * - LCD VSS pin to ground
+ * - LCD VDD pin to 5V
+ * - 10k ohm potentiometer: ends to 5V and ground, wiper to LCD V0
+ * - 150 ohm resistor from 5V to LCD Anode
+ * - LCD Cathode to ground
+ * - ----
+ * - some analog input to Arduino pin A1 (unconnected also works)
+ *
+ * https://github.com/VasilKalchev/LiquidMenu
+ *
+ */
+
+// The menu wrapper library
+#include <LiquidMenu.h>
+// The library's own parallel backend
+#include <LiquidParallel.h>
+
+// Pin mapping for the display:
+const byte LCD_RS = 12;
+const byte LCD_RW = 10;
+const byte LCD_E = 11;
+const byte LCD_D4 = 5;
+const byte LCD_D5 = 4;
+const byte LCD_D6 = 3;
+const byte LCD_D7 = 2;
+// Without the R/W pin: LiquidParallel lcd(LCD_RS, LCD_E, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
+LiquidParallel lcd(LCD_RS, LCD_RW, LCD_E, LCD_D4, LCD_D5, LCD_D6, LCD_D7);
+// The driver through which the menu sends the commands to the display.
+auto lcd_driver = make_liquidDriver(lcd);
+
+// The "A1" alias used in the wiring diagram above is an AVR (Uno,
+// Nano, ...) convention. On boards without it, e.g. ESP32, use any
+// ADC-capable GPIO instead.
+#if defined(ARDUINO_ARCH_AVR)
+const byte analogPin = A1;
+#else
+const byte analogPin = 34;
+#endif
+
+unsigned short analogReading = 0;
+unsigned short lastAnalogReading = 0;
+
+unsigned int period_check = 1000;
+unsigned long lastMs_check = 0;
+
+unsigned int period_nextScreen = 5000;
+unsigned long lastMs_nextScreen = 0;
+
+LiquidLine welcome_line1(1, 0, "LiquidMenu ", LIQUIDMENU_VERSION);
+LiquidLine welcome_line2(1, 1, "Hello Parallel");
+LiquidScreen welcome_screen(welcome_line1, welcome_line2);
+
+LiquidLine analogReading_line(0, 0, "Analog: ", analogReading);
+LiquidScreen secondary_screen(analogReading_line);
+
+// The menu is given the driver instead of the display object.
+LiquidMenu menu(lcd_driver, welcome_screen, secondary_screen);
+
+
+void setup() {
+  Serial.begin(250000);
+
+  pinMode(analogPin, INPUT);
+
+  lcd.begin(16, 2);
+  menu.update();
+}
+
+void loop() {
+  // Periodic reading of the analog pin.
+  if (millis() - lastMs_check > period_check) {
+    lastMs_check = millis();
+    analogReading = analogRead(analogPin);
+    if (analogReading != lastAnalogReading) {
+      lastAnalogReading = analogReading;
+      menu.update();
+    }
+  }
+
+  // Periodic switching to the next screen, a full redraw.
+  if (millis() - lastMs_nextScreen > period_nextScreen) {
+    lastMs_nextScreen = millis();
+    menu.next_screen();
+    Serial.print(F("Render: "));
+    Serial.print(menu.get_stats().lastRenderUs);
+    Serial.println(F(" us"));
+  }
+}
@@ -0,0 +1,168 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Vasil Kalchev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+@file
+Contains the LiquidFlashScreen class definition.
+*/
+
+#include "LiquidMenu.h"
+
+
+/// A line loaded from its definition in flash memory.
+/**
+The flash screens share one object, a line is loaded into it when it's
+printed or focused and is valid until the next one is loaded. The lines
+marked for a redraw by `refresh_getters()` keep their marks in a mask
+while the other lines are loaded.
+*/
+class LiquidFlashLine : public LiquidLineBase {
+public:
+	LiquidFlashLine()
+		: LiquidLineBase(0, 0), _dueLines(_dueBits, MAX_LINES), _index(0) {}
+
+	/// Loads a line's definition from flash memory.
+	/**
+	@param *p_definition - the line's definition in flash memory
+	@param index - index of the line in its screen
+	@param focusPosition - overrides the defined focus position if not 0
+	*/
+	void load(const LiquidLineDef *p_definition, uint8_t index,
+	          uint8_t focusPosition) {
+		_dueLines.set(_index, _refreshDue);
+		_refreshDue = _dueLines.is_set(index);
+		_index = index;
+		memcpy_P(&_definition, p_definition, sizeof(_definition));
+		set_position(_definition.column, _definition.row);
+		if (focusPosition != 0) {
+			set_focusPosition((Position)focusPosition);
+		} else {
+			set_focusPosition(_definition.focusPosition,
+			                  _definition.focusColumn, _definition.focusRow);
+		}
+		set_decimalPlaces(_definition.decimalPlaces);
+		_focusable = (_definition.functionCount > 0);
+	}
+
+private:
+	virtual void print_variables(LiquidFrame *p_frame) {
+		for (uint8_t v = 0; v < _definition.variableCount; v++) {
+			LiquidVariableDef variable;
+			memcpy_P(&variable, &_definition.p_variables[v], sizeof(variable));
+			p_frame->begin_variable();
+			// The getters are read through `p_variable`, the same way
+			// LiquidLine keeps them.
+			print_variable(p_frame, variable.p_variable, variable.type,
+			               _floatDecimalPlaces);
+		}
+	}
+
+	virtual bool query_getters() {
+		bool changed = false;
+		for (uint8_t v = 0; v < _definition.variableCount; v++) {
+			LiquidVariableDef variable;
+			memcpy_P(&variable, &_definition.p_variables[v], sizeof(variable));
+			if (((uint8_t)variable.type > (uint8_t)DataType::FIRST_GETTER)
+			    && query_getter(variable.p_variable, variable.type)) {
+				changed = true;
+			}
+		}
+		return changed;
+	}
+
+	/// Finds a function in the line's definition.
+	/**
+	@param number - number identifying the function
+	@returns pointer to the function or nullptr
+	*/
+	void (*find_function(uint8_t number) const)(void) {
+		for (uint8_t f = 0; f < _definition.functionCount; f++) {
+			LiquidFunctionDef function;
+			memcpy_P(&function, &_definition.p_functions[f], sizeof(function));
+			if (function.number == number) {
+				return function.function;
+			}
+		}
+		return nullptr;
+	}
+
+	virtual bool is_callable(uint8_t number) const {
+		return find_function(number) != nullptr;
+	}
+
+	virtual bool call_function(uint8_t number) const {
+		void (*function)(void) = find_function(number);
+		if (function != nullptr) {
+			function();
+			return true;
+		}
+		return false;
+	}
+
+	LiquidLineDef _definition; ///< The loaded definition
+	uint8_t _dueBits[(MAX_LINES + 7) / 8]; ///< Storage for the mask
+	LiquidIndexMask _dueLines; ///< The lines marked for a redraw
+	uint8_t _index; ///< Index of the loaded line
+};
+
+/// The line loaded by the flash screens.
+static LiquidFlashLine flashLine;
+
+
+LiquidFlashScreen::LiquidFlashScreen()
+	: LiquidScreenBase(nullptr, 0, _focusableBits, MAX_LINES), _p_lines(nullptr),
+	  _focusPosition(0) {}
+
+LiquidFlashScreen::LiquidFlashScreen(const LiquidFlashScreen &other)
+	: LiquidScreenBase(other, nullptr, _focusableBits), _p_lines(other._p_lines),
+	  _focusPosition(other._focusPosition) {}
+
+void LiquidFlashScreen::load(const LiquidScreenDef *p_definition) {
+	LiquidScreenDef definition;
+	memcpy_P(&definition, p_definition, sizeof(definition));
+	load(definition.p_lines, definition.lineCount);
+}
+
+void LiquidFlashScreen::load(const LiquidLineDef *p_lines, uint8_t lineCount) {
+	_p_lines = p_lines;
+	if (lineCount > MAX_LINES) {
+		DEBUGLN(F("Too many lines, edit LiquidMenu_config.h to allow for more lines"));
+		lineCount = MAX_LINES;
+	}
+	set_lineCount(lineCount);
+}
+
+bool LiquidFlashScreen::set_focusPosition(Position position) {
+	if (position == Position::CUSTOM) {
+		DEBUGLN(F("Can't set focus position to 'CUSTOM' for the whole screen at once"));
+		return false;
+	}
+	_focusPosition = (uint8_t)position;
+	return true;
+}
+
+LiquidLineBase* LiquidFlashScreen::get_line(uint8_t index) const {
+	flashLine.load(&_p_lines[index], index, _focusPosition);
+	return &flashLine;
+}
@@ -0,0 +1,360 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Vasil Kalchev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/**
+@file
+Contains the LiquidFrame class definition.
+*/
+
+#include <math.h>
+
+#include "LiquidMenu.h"
+
+/// The numbers from 0 to 99 as two characters each.
+static const char DIGIT_PAIRS[] PROGMEM =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/// The powers of ten that fit in `uint32_t`.
+static const uint32_t POWERS_OF_TEN[10] = {
+	1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL,
+	1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+/// Puts a number from 0 to 99 as two digits before a position in a buffer.
+static inline char* put_digitPair(char *p_position, uint8_t pair) {
+	*--p_position = pgm_read_byte(&DIGIT_PAIRS[pair * 2 + 1]);
+	*--p_position = pgm_read_byte(&DIGIT_PAIRS[pair * 2]);
+	return p_position;
+}
+
+/// Formats an unsigned number at the end of a buffer.
+/**
+The digits are produced two at a time and the slower 32 bit divisions are
+used only while the number doesn't fit in 16 bits.
+
+@param value - the number
+@param *p_end - pointer one past the end of the buffer
+@returns pointer to the first digit
+*/
+static char* format_unsigned(uint32_t value, char *p_end) {
+	char *p_position = p_end;
+	while (value > 0xFFFF) {
+		uint32_t quotient = value / 100;
+		p_position = put_digitPair(p_position, value - quotient * 100);
+		value = quotient;
+	}
+	uint16_t shortValue = value;
+	while (shortValue >= 100) {
+		uint16_t quotient = shortValue / 100;
+		p_position = put_digitPair(p_position, shortValue - quotient * 100);
+		shortValue = quotient;
+	}
+	if (shortValue >= 10) {
+		p_position = put_digitPair(p_position, shortValue);
+	} else {
+		*--p_position = '0' + shortValue;
+	}
+	return p_position;
+}
+
+
+LiquidFrame::LiquidFrame()
+	: _column(0), _row(0), _columnLimit(MAX_COLUMNS), _fieldStart(0),
+	  _fieldAlign(Align::LEFT), _p_menu(nullptr) {
+	clear();
+}
+
+void LiquidFrame::clear() {
+	memset(_cell, ' ', sizeof(_cell));
+	memset(_glyphCell, 0, sizeof(_glyphCell));
+	memset(_writtenCell, 0, sizeof(_writtenCell));
+	memset(_markedCell, 0, sizeof(_markedCell));
+	_glyphCount = 0;
+	_reservedGlyphs = 0;
+	_column = 0;
+	_row = 0;
+	_columnLimit = MAX_COLUMNS;
+	_targeted = false;
+	_lineTargeted = false;
+	_targetVariable = 0;
+	_variable = 0;
+	_marking = false;
+}
+
+inline void LiquidFrame::mark_cell(uint8_t column) {
+	if (!_targeted) {
+		return;
+	}
+	const uint8_t bit = 1 << (column % 8);
+	_writtenCell[_row][column / 8] |= bit;
+	// A cell overwritten by a later line belongs to that line.
+	if (_marking) {
+		_markedCell[_row][column / 8] |= bit;
+	} else {
+		_markedCell[_row][column / 8] &= ~bit;
+	}
+}
+
+void LiquidFrame::put_cell(uint8_t column, uint8_t character, bool isGlyph) {
+	_cell[_row][column] = character;
+	if (isGlyph) {
+		_glyphCell[_row][column / 8] |= 1 << (column % 8);
+	} else {
+		_glyphCell[_row][column / 8] &= ~(1 << (column % 8));
+	}
+	mark_cell(column);
+}
+
+void LiquidFrame::setCursor(uint8_t column, uint8_t row) {
+	_column = column;
+	_row = row;
+}
+
+size_t LiquidFrame::write(uint8_t character) {
+	if ((_row < MAX_ROWS) && (_column < _columnLimit)) {
+		_cell[_row][_column] = character;
+		_glyphCell[_row][_column / 8] &= ~(1 << (_column % 8));
+		mark_cell(_column);
+		_column++;
+	}
+	return 1;
+}
+
+size_t LiquidFrame::write(const uint8_t *buffer, size_t size) {
+	if (_row < MAX_ROWS) {
+		for (size_t i = 0; (i < size) && (_column < _columnLimit); i++) {
+			_cell[_row][_column] = buffer[i];
+			_glyphCell[_row][_column / 8] &= ~(1 << (_column % 8));
+			mark_cell(_column);
+			_column++;
+		}
+	}
+	return size;
+}
+
+void LiquidFrame::print_unsigned(uint32_t value) {
+	char buffer[10];
+	char *p_end = buffer + sizeof(buffer);
+	char *p_start = format_unsigned(value, p_end);
+	write(reinterpret_cast<const uint8_t*>(p_start), p_end - p_start);
+}
+
+void LiquidFrame::print_signed(int32_t value) {
+	char buffer[11];
+	char *p_end = buffer + sizeof(buffer);
+	uint32_t magnitude = (value < 0) ? -static_cast<uint32_t>(value) : value;
+	char *p_start = format_unsigned(magnitude, p_end);
+	if (value < 0) {
+		*--p_start = '-';
+	}
+	write(reinterpret_cast<const uint8_t*>(p_start), p_end - p_start);
+}
+
+void LiquidFrame::print_float(double value, uint8_t decimalPlaces) {
+	// Print handles the values that don't fit in the integer parts.
+	if (isnan(value) || isinf(value) || (value > 4294967040.0)
+	    || (value < -4294967040.0) || (decimalPlaces > 9)) {
+		print(value, decimalPlaces);
+		return;
+	}
+	char buffer[21];
+	char *p_end = buffer + sizeof(buffer);
+	char *p_start = p_end;
+	bool negative = (value < 0.0);
+	if (negative) {
+		value = -value;
+	}
+	const uint32_t scale = POWERS_OF_TEN[decimalPlaces];
+	// Rounds the same way as Print.
+	value += 0.5 / scale;
+	const uint32_t integerPart = static_cast<uint32_t>(value);
+	if (decimalPlaces > 0) {
+		// The fraction is scaled to an integer once instead of multiplying
+		// the remainder for every digit.
+		uint32_t fractionPart = static_cast<uint32_t>((value - integerPart) * scale);
+		if (fractionPart >= scale) {
+			fractionPart = scale - 1;
+		}
+		p_start = format_unsigned(fractionPart, p_end);
+		while (p_start > p_end - decimalPlaces) {
+			*--p_start = '0';
+		}
+		*--p_start = '.';
+	}
+	p_start = format_unsigned(integerPart, p_start);
+	if (negative) {
+		*--p_start = '-';
+	}
+	write(reinterpret_cast<const uint8_t*>(p_start), p_end - p_start);
+}
+
+void LiquidFrame::print_progmem(const char *text) {
+	// Copies the string from flash in chunks, it's read only once and
+	// the stack usage doesn't depend on its length.
+	uint8_t chunk[8];
+	uint8_t size = 0;
+	for (uint8_t character = pgm_read_byte(text); character != '\0';
+	     character = pgm_read_byte(++text)) {
+		chunk[size++] = character;
+		if (size == sizeof(chunk)) {
+			write(chunk, size);
+			size = 0;
+		}
+	}
+	write(chunk, size);
+}
+
+void LiquidFrame::write_glyph(uint8_t *bitmap) {
+	uint8_t glyph = 0;
+	while ((glyph < _glyphCount) && (_p_glyph[glyph] != bitmap)) {
+		glyph++;
+	}
+	if ((bitmap == nullptr) || (glyph == GLYPH_SLOTS)) {
+		write((uint8_t)' ');
+		return;
+	}
+	if (glyph == _glyphCount) {
+		_p_glyph[glyph] = bitmap;
+		_glyphCount++;
+	}
+	// The cell holds the glyph's index in `_p_glyph` until the menu
+	// replaces it with the glyph's character code.
+	const uint8_t column = _column;
+	write(glyph);
+	if ((_row < MAX_ROWS) && (column < _columnLimit)) {
+		_glyphCell[_row][column / 8] |= 1 << (column % 8);
+	}
+}
+
+void LiquidFrame::write_glyphIndex(uint8_t index) {
+	_reservedGlyphs |= 1 << (index % GLYPH_SLOTS);
+	write(index);
+}
+
+void LiquidFrame::write_focusGlyph(Position position) {
+	if (_p_menu != nullptr) {
+		write_glyph(_p_menu->_p_focusGlyph[(uint8_t)position - 1]);
+	} else {
+		write((uint8_t)' ');
+	}
+}
+
+void LiquidFrame::begin_line(bool isTarget) {
+	_lineTargeted = isTarget;
+	_variable = 0;
+	_marking = isTarget && (_targetVariable == 0);
+}
+
+void LiquidFrame::begin_variable() {
+	_variable++;
+	if (_lineTargeted && (_variable == _targetVariable)) {
+		_marking = true;
+	}
+}
+
+void LiquidFrame::end_line() {
+	_lineTargeted = false;
+	_marking = false;
+}
+
+void LiquidFrame::begin_field(uint8_t width, Align align) {
+	_fieldStart = _column;
+	_fieldAlign = align;
+	_columnLimit = (_column + width < MAX_COLUMNS) ? _column + width : MAX_COLUMNS;
+}
+
+void LiquidFrame::end_field() {
+	const uint8_t end = _columnLimit;
+	_columnLimit = MAX_COLUMNS;
+	if ((_row >= MAX_ROWS) || (_column >= end)) {
+		return;
+	}
+	const uint8_t padding = end - _column;
+	if (_fieldAlign == Align::LEFT) {
+		for (uint8_t c = _column; c < end; c++) {
+			put_cell(c, ' ', false);
+		}
+	} else {
+		// Moves the value to the end of the field, starting from its
+		// last character.
+		for (uint8_t c = _column; c > _fieldStart; c--) {
+			const uint8_t from = c - 1;
+			put_cell(from + padding, _cell[_row][from],
+			         _glyphCell[_row][from / 8] & (1 << (from % 8)));
+		}
+		const uint8_t valueStart = _fieldStart + padding;
+		const bool negative = (_fieldAlign == Align::ZERO) && (valueStart < end)
+		                      && (_cell[_row][valueStart] == '-');
+		const uint8_t pad = (_fieldAlign == Align::ZERO) ? '0' : ' ';
+		for (uint8_t c = _fieldStart; c < valueStart; c++) {
+			put_cell(c, pad, false);
+		}
+		// The sign goes before the zeros.
+		if (negative) {
+			put_cell(_fieldStart, '-', false);
+			put_cell(valueStart, '0', false);
+		}
+	}
+	_column = end;
+}
+
+bool LiquidFrame::close_region() {
+	bool marked = false;
+	for (uint8_t r = 0; r < MAX_ROWS; r++) {
+		bool inRegion = false;
+		for (uint8_t c = 0; c < MAX_COLUMNS; c++) {
+			const uint8_t bit = 1 << (c % 8);
+			if (_writtenCell[r][c / 8] & bit) {
+				inRegion = _markedCell[r][c / 8] & bit;
+			} else if (inRegion) {
+				_markedCell[r][c / 8] |= bit;
+			}
+			marked = marked || inRegion;
+		}
+	}
+	return marked;
+}
+
+bool LiquidFrame::is_inRegion(uint8_t row, uint8_t column) const {
+	return !_targeted
+	       || (_markedCell[row][column / 8] & (1 << (column % 8)));
+}
+
+uint8_t LiquidFrame::get_character(uint8_t row, uint8_t column, const uint8_t code[]) const {
+	// The glyphs are kept as indexes, every display has its own codes.
+	if (_glyphCell[row][column / 8] & (1 << (column % 8))) {
+		return code[_cell[row][column]];
+	}
+	return _cell[row][column];
+}
+
+void LiquidFrame::print_value(const LiquidProgmem &progmem, uint8_t decimalPlaces) {
+	print_progmem(progmem.text);
+	(void)decimalPlaces;
+}
@@ -0,0 +1,115 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Vasil Kalchev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+@file
+Contains the LiquidGlyphSlots class definition.
+*/
+
+#include "LiquidMenu.h"
+
+
+LiquidGlyphSlots::LiquidGlyphSlots() {
+	clear();
+}
+
+void LiquidGlyphSlots::clear() {
+	for (uint8_t s = 0; s < GLYPH_SLOTS; s++) {
+		_p_bitmap[s] = nullptr;
+		// The top slots are used first, the user's glyphs usually start
+		// from the bottom.
+		_order[s] = GLYPH_SLOTS - 1 - s;
+	}
+	_usedInFrame = 0;
+	_reserved = 0;
+}
+
+void LiquidGlyphSlots::next_frame() {
+	_usedInFrame = 0;
+}
+
+uint8_t LiquidGlyphSlots::find(const uint8_t *bitmap) const {
+	for (uint8_t s = 0; s < GLYPH_SLOTS; s++) {
+		if (_p_bitmap[s] == bitmap) {
+			return s;
+		}
+	}
+	// A different array with the same bitmap doesn't need an upload either.
+	for (uint8_t s = 0; s < GLYPH_SLOTS; s++) {
+		if ((_p_bitmap[s] != nullptr) && (memcmp(_p_bitmap[s], bitmap, 8) == 0)) {
+			return s;
+		}
+	}
+	return GLYPH_SLOTS;
+}
+
+uint8_t LiquidGlyphSlots::select() const {
+	uint8_t selected = GLYPH_SLOTS;
+	for (uint8_t o = 0; o < GLYPH_SLOTS; o++) {
+		const uint8_t slot = _order[o];
+		const uint8_t mask = 1 << slot;
+		if ((_reserved & mask) || (_usedInFrame & mask)) {
+			continue;
+		}
+		if (_p_bitmap[slot] == nullptr) {
+			return slot;
+		}
+		// The order is most recently used first, so the last one wins.
+		selected = slot;
+	}
+	return selected;
+}
+
+void LiquidGlyphSlots::assign(uint8_t slot, const uint8_t *bitmap) {
+	_p_bitmap[slot] = bitmap;
+}
+
+void LiquidGlyphSlots::use(uint8_t slot) {
+	uint8_t o = 0;
+	while ((o < GLYPH_SLOTS - 1) && (_order[o] != slot)) {
+		o++;
+	}
+	for (; o > 0; o--) {
+		_order[o] = _order[o - 1];
+	}
+	_order[0] = slot;
+	_usedInFrame |= 1 << slot;
+}
+
+void LiquidGlyphSlots::forget(const uint8_t *bitmap) {
+	for (uint8_t s = 0; s < GLYPH_SLOTS; s++) {
+		if (_p_bitmap[s] == bitmap) {
+			_p_bitmap[s] = nullptr;
+		}
+	}
+}
+
+void LiquidGlyphSlots::reserve(uint8_t slot) {
+	slot %= GLYPH_SLOTS;
+	if (!(_reserved & (1 << slot))) {
+		_reserved |= 1 << slot;
+		// The user has overwritten whatever was uploaded there.
+		_p_bitmap[slot] = nullptr;
+	}
+}
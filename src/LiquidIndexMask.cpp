@@ -0,0 +1,100 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Vasil Kalchev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/**
+@file
+Contains the LiquidIndexMask class definition.
+*/
+
+#include "LiquidMenu.h"
+
+/// Returns the position of the highest set bit of a non-zero byte.
+static uint8_t highest_bit(uint8_t bits) {
+	return (8 * sizeof(unsigned int) - 1) - __builtin_clz(bits);
+}
+
+
+LiquidIndexMask::LiquidIndexMask(uint8_t *p_bits, uint8_t capacity)
+	: _p_bits(p_bits), _capacity(capacity) {
+	for (uint8_t b = 0; b < (_capacity + 7) / 8; b++) {
+		_p_bits[b] = 0;
+	}
+}
+
+void LiquidIndexMask::copy(const LiquidIndexMask &other) {
+	const uint8_t capacity = (other._capacity < _capacity) ? other._capacity : _capacity;
+	for (uint8_t b = 0; b < (capacity + 7) / 8; b++) {
+		_p_bits[b] = other._p_bits[b];
+	}
+}
+
+void LiquidIndexMask::set(uint8_t index, bool value) {
+	if (index >= _capacity) {
+		return;
+	}
+	if (value) {
+		_p_bits[index >> 3] |= (1 << (index & 7));
+	} else {
+		_p_bits[index >> 3] &= ~(1 << (index & 7));
+	}
+}
+
+bool LiquidIndexMask::is_set(uint8_t index) const {
+	return (index < _capacity) && (_p_bits[index >> 3] & (1 << (index & 7)));
+}
+
+uint8_t LiquidIndexMask::get_capacity() const {
+	return _capacity;
+}
+
+uint8_t LiquidIndexMask::find_next(uint8_t from, uint8_t end) const {
+	const uint8_t limit = (end < _capacity) ? end : _capacity;
+	// 16 bits so that stepping past the last byte doesn't wrap around
+	uint16_t i = from;
+	while (i < limit) {
+		const uint8_t bits = _p_bits[i >> 3] >> (i & 7);
+		if (bits != 0) {
+			i += __builtin_ctz(bits);
+			return (i < limit) ? i : end;
+		}
+		// the rest of the byte is clear
+		i = (i | 7) + 1;
+	}
+	return end;
+}
+
+uint8_t LiquidIndexMask::find_previous(uint8_t end) const {
+	uint8_t i = (end < _capacity) ? end : _capacity;
+	while (i > 0) {
+		i--;
+		// the bits of the byte up to and including `i`
+		const uint8_t bits = _p_bits[i >> 3] & (0xFF >> (7 - (i & 7)));
+		if (bits != 0) {
+			return (i & ~7) + highest_bit(bits);
+		}
+		i &= ~7;
+	}
+	return end;
+}
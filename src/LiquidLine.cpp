@@ -27,40 +27,333 @@ SOFTWARE.
 Contains the LiquidLine class definition.
 */
 
+#include <Arduino.h>
+
 #include "LiquidMenu.h"
 
+static_assert(MAX_LINE_SLOTS < NO_SLOT, "MAX_LINE_SLOTS must be less than 255");
+static_assert(MAX_COLUMNS < 64, "The lines' columns are kept in 6 bits");
+static_assert(MAX_ROWS < 8, "The lines' rows are kept in 3 bits");
+
+/// A variable of a LiquidLine or an attached function of a line.
+struct LiquidLineSlot {
+	const void *p_item; ///< Pointer to the variable or the function
+	uint8_t tag; ///< The variable's `DataType` or the function's number
+	uint8_t next; ///< Handle of the next slot of the same line
+	uint8_t field; ///< The variable's field width and `Align` in the top bits
+};
+
+/// The bits of `LiquidLineSlot::field` holding the width.
+const uint8_t FIELD_WIDTH_MASK = 0x3F;
+
+/// The tag of the slot keeping a line's refresh period in `p_item`, it's
+/// kept with the functions, which are numbered from 1.
+const uint8_t REFRESH_PERIOD_TAG = 0;
+
+/// The slots shared by all lines, a line keeps only the first's handle.
+static LiquidLineSlot slot[MAX_LINE_SLOTS];
+
+/// Count of the slots that were ever taken, the rest were never used.
+static uint8_t slotCount = 0;
+
+/// Handle of the first released slot, they are chained through `next`.
+static uint8_t releasedSlots = NO_SLOT;
+
+/// Count of the slots that were asked for when none was left.
+static uint8_t missingSlots = 0;
+
+/// A value returned by a getter function.
+union LiquidGetterValue {
+	bool boolean;
+	char character;
+	int8_t int8;
+	uint8_t uint8;
+	int16_t int16;
+	uint16_t uint16;
+	int32_t int32;
+	uint32_t uint32;
+	float real;
+	double realDouble;
+	const char *text;
+};
+
+/// The last value returned by a getter function.
+struct LiquidGetterCache {
+	const void *p_getter; ///< The getter function, nullptr for a free entry
+	DataType type; ///< The value's data type, `NOT_USED` until it's called
+	uint16_t interval; ///< Minimum milliseconds between the calls
+	uint16_t time; ///< Low 16 bits of `millis()` at the last call
+	LiquidGetterValue value; ///< The last returned value
+};
+
+/// The getters added to the lines, the entries are never released.
+static LiquidGetterCache getterCache[MAX_GETTER_CACHES];
+
+/// Count of the getters of LiquidLine objects that were refused an entry.
+static uint8_t missingGetterCaches = 0;
+
+/// When true the cached getters are not called again.
+static bool getterHold = false;
+
+uint16_t LiquidLineBase::_focusableChanges = 0;
+
+/// Limits a coordinate to a bitfield, the largest value is never shown.
+static uint8_t fit_coordinate(uint8_t coordinate, uint8_t largest) {
+	return (coordinate < largest) ? coordinate : largest;
+}
+
+
+/// Calls a getter function.
+/**
+@param *p_getter - the getter function
+@param getterType - the getter's `DataType`
+@param &value - receives the returned value
+@returns the `DataType` of the value, `NOT_USED` for an unknown getter
+*/
+static DataType call_getter(const void *p_getter, DataType getterType,
+                            LiquidGetterValue &value) {
+	switch (getterType) {
+		case DataType::CONST_CHAR_PTR_GETTER: {
+			value.text = reinterpret_cast<constcharPtrFnPtr>(p_getter)();
+			return DataType::CONST_CHAR_PTR;
+		} // case CONST_CHAR_PTR_GETTER
+		case DataType::CHAR_PTR_GETTER: {
+			value.text = reinterpret_cast<charPtrFnPtr>(p_getter)();
+			return DataType::CHAR_PTR;
+		} // case CHAR_PTR_GETTER
+		case DataType::CHAR_GETTER: {
+			value.character = reinterpret_cast<charFnPtr>(p_getter)();
+			return DataType::CHAR;
+		} // case CHAR_GETTER
+		case DataType::INT8_T_GETTER: {
+			value.int8 = reinterpret_cast<int8tFnPtr>(p_getter)();
+			return DataType::INT8_T;
+		} // case INT8_T_GETTER
+		case DataType::UINT8_T_GETTER: {
+			value.uint8 = reinterpret_cast<uint8tFnPtr>(p_getter)();
+			return DataType::UINT8_T;
+		} // case UINT8_T_GETTER
+		case DataType::INT16_T_GETTER: {
+			value.int16 = reinterpret_cast<int16tFnPtr>(p_getter)();
+			return DataType::INT16_T;
+		} // case INT16_T_GETTER
+		case DataType::UINT16_T_GETTER: {
+			value.uint16 = reinterpret_cast<uint16tFnPtr>(p_getter)();
+			return DataType::UINT16_T;
+		} // case UINT16_T_GETTER
+		case DataType::INT32_T_GETTER: {
+			value.int32 = reinterpret_cast<int32tFnPtr>(p_getter)();
+			return DataType::INT32_T;
+		} // case INT32_T_GETTER
+		case DataType::UINT32_T_GETTER: {
+			value.uint32 = reinterpret_cast<uint32tFnPtr>(p_getter)();
+			return DataType::UINT32_T;
+		} // case UINT32_T_GETTER
+		case DataType::FLOAT_GETTER: {
+			value.real = reinterpret_cast<floatFnPtr>(p_getter)();
+			return DataType::FLOAT;
+		} // case FLOAT_GETTER
+		case DataType::DOUBLE_GETTER: {
+			value.realDouble = reinterpret_cast<doubleFnPtr>(p_getter)();
+			return DataType::DOUBLE;
+		} // case DOUBLE_GETTER
+		case DataType::BOOL_GETTER: {
+			value.boolean = reinterpret_cast<boolFnPtr>(p_getter)();
+			return DataType::BOOL;
+		} // case BOOL_GETTER
+		default: { return DataType::NOT_USED; }
+	} //switch (getterType)
+}
+
+/// Finds a getter's cache entry.
+/**
+@param *p_getter - the getter function
+@param take - takes a free entry if the getter doesn't have one
+@returns the entry or nullptr if the getter isn't cached
+*/
+static LiquidGetterCache* find_getterCache(const void *p_getter, bool take) {
+	for (uint8_t e = 0; e < MAX_GETTER_CACHES; e++) {
+		if (getterCache[e].p_getter == p_getter) {
+			return &getterCache[e];
+		}
+		if (getterCache[e].p_getter == nullptr) {
+			if (!take) {
+				return nullptr;
+			}
+			getterCache[e].p_getter = p_getter;
+			getterCache[e].type = DataType::NOT_USED;
+			getterCache[e].interval = 0;
+			return &getterCache[e];
+		}
+	}
+	return nullptr;
+}
+
+/// Reads a getter's value, through its cache if it has one.
+/**
+A cached getter is called only if its re-query interval has elapsed and
+the getters are not held. A getter takes a free entry when it's first
+read, one that didn't get any is called every time and its value is
+always new.
+
+@param *p_getter - the getter function
+@param getterType - the getter's `DataType`
+@param &value - receives the value
+@param &changed - set to true if the getter returned a new value
+@returns the `DataType` of the value, `NOT_USED` if there is none
+*/
+static DataType read_getter(const void *p_getter, DataType getterType,
+                            LiquidGetterValue &value, bool &changed) {
+	changed = false;
+	if (p_getter == nullptr) {
+		return DataType::NOT_USED;
+	}
+	// The unused bytes are cleared so that the values can be compared whole.
+	memset(&value, 0, sizeof(value));
+	LiquidGetterCache *p_entry = find_getterCache(p_getter, true);
+	if (p_entry == nullptr) {
+		changed = true;
+		return call_getter(p_getter, getterType, value);
+	}
+	const uint16_t now = millis();
+	if ((p_entry->type != DataType::NOT_USED)
+	    && (getterHold || ((uint16_t)(now - p_entry->time) < p_entry->interval))) {
+		value = p_entry->value;
+		return p_entry->type;
+	}
+	const DataType type = call_getter(p_getter, getterType, value);
+	// A `const char*` getter is compared by the pointer, its text can't
+	// change. The text behind a `char*` getter's pointer can change
+	// without the pointer changing, it's always treated as new.
+	changed = (type != p_entry->type) || (type == DataType::CHAR_PTR)
+	          || (memcmp(&value, &p_entry->value, sizeof(value)) != 0);
+	p_entry->type = type;
+	p_entry->value = value;
+	p_entry->time = now;
+	return type;
+}
+
+
+LiquidLineBase::LiquidLineBase(uint8_t column, uint8_t row)
+	: _column(fit_coordinate(column, 63)), _focusPosition((uint8_t)Position::NORMAL),
+	  _focusColumn(0), _focusable(false), _row(fit_coordinate(row, 7)),
+	  _focusRow(0), _refreshDue(false), _floatDecimalPlaces(2),
+	  _functions(NO_SLOT) {}
+
+void LiquidLineBase::set_position(uint8_t column, uint8_t row) {
+	_column = fit_coordinate(column, 63);
+	_row = fit_coordinate(row, 7);
+}
 
-bool LiquidLine::attach_function(uint8_t number, void (*function)(void)) {
+LiquidLineBase::LiquidLineBase(LiquidLineBase &&other)
+	: _column(other._column), _focusPosition(other._focusPosition),
+	  _focusColumn(other._focusColumn), _focusable(other._focusable),
+	  _row(other._row), _focusRow(other._focusRow),
+	  _refreshDue(other._refreshDue),
+	  _floatDecimalPlaces(other._floatDecimalPlaces),
+	  _functions(other._functions) {
+	other._functions = NO_SLOT;
+}
+
+LiquidLineBase::~LiquidLineBase() {
+	release_slots(_functions);
+}
+
+uint8_t LiquidLineBase::get_freeSlots() {
+	uint8_t count = MAX_LINE_SLOTS - slotCount;
+	for (uint8_t s = releasedSlots; s != NO_SLOT; s = slot[s].next) {
+		count++;
+	}
+	return count;
+}
+
+uint8_t LiquidLineBase::get_missingSlots() {
+	return missingSlots;
+}
+
+bool LiquidLineBase::append_slot(uint8_t &list, const void *p_item, uint8_t tag) {
+	uint8_t s;
+	if (releasedSlots != NO_SLOT) {
+		s = releasedSlots;
+		releasedSlots = slot[s].next;
+	} else if (slotCount < MAX_LINE_SLOTS) {
+		s = slotCount++;
+	} else {
+		if (missingSlots < 0xFF) {
+			missingSlots++;
+		}
+		return false;
+	}
+	uint8_t *p_handle = &list;
+	while (*p_handle != NO_SLOT) {
+		p_handle = &slot[*p_handle].next;
+	}
+	slot[s].p_item = p_item;
+	slot[s].tag = tag;
+	slot[s].next = NO_SLOT;
+	slot[s].field = 0;
+	*p_handle = s;
+	return true;
+}
+
+void LiquidLineBase::release_slots(uint8_t &list) {
+	if (list == NO_SLOT) {
+		return;
+	}
+	uint8_t last = list;
+	while (slot[last].next != NO_SLOT) {
+		last = slot[last].next;
+	}
+	slot[last].next = releasedSlots;
+	releasedSlots = list;
+	list = NO_SLOT;
+}
+
+bool LiquidLineBase::attach_function(uint8_t number, void (*function)(void)) {
 	DEBUG(F("LLine ")); print_me(reinterpret_cast<uintptr_t>(this));
 
 	DEBUG(F("Attach function ")); DEBUG(number);
 
-	if (number <= MAX_FUNCTIONS) {
-		_function[number - 1] = function;
-		_focusable = true;
+	if ((number == 0) || (number > MAX_FUNCTIONS)) {
+		DEBUGLN(F(" failed, edit LiquidMenu_config.h to allow for more functions"));
+		return false;
+	}
+	// A function attached again under the same number replaces the old one.
+	for (uint8_t s = _functions; s != NO_SLOT; s = slot[s].next) {
+		if (slot[s].tag == number) {
+			slot[s].p_item = reinterpret_cast<const void*>(function);
+			DEBUGLN(F(""));
+			return true;
+		}
+	}
+	if (append_slot(_functions, reinterpret_cast<const void*>(function), number)) {
+		if (!_focusable) {
+			_focusable = true;
+			_focusableChanges++;
+		}
 
 		DEBUGLN(F(""));
 		return true;
 	} else {
-		DEBUGLN(F(" failed, edit LiquidMenu_config.h to allow for more functions"));
+		DEBUGLN(F(" failed, edit LiquidMenu_config.h to allow for more line slots"));
 		return false;
 	}
 }
 
-void LiquidLine::set_decimalPlaces(uint8_t decimalPlaces) {
+void LiquidLineBase::set_decimalPlaces(uint8_t decimalPlaces) {
 	_floatDecimalPlaces = decimalPlaces;
 }
 
-bool LiquidLine::set_focusPosition(Position position,
+bool LiquidLineBase::set_focusPosition(Position position,
 								   uint8_t column, uint8_t row) {
 	DEBUG(F("LLine ")); print_me(reinterpret_cast<uintptr_t>(this));
 
 	if (position <= Position::CUSTOM) {
-		_focusPosition = position;
-		_focusColumn = column;
-		_focusRow = row;
+		_focusPosition = (uint8_t)position;
+		_focusColumn = fit_coordinate(column, 63);
+		_focusRow = fit_coordinate(row, 7);
 		DEBUG(F("Focus position set to ")); DEBUG((uint8_t)_focusPosition);
-		if (_focusPosition == Position::CUSTOM) {
+		if (position == Position::CUSTOM) {
 			DEBUG(F(" at (")); DEBUG(_focusRow); DEBUG(F(", "));
 			DEBUG(_focusColumn); DEBUG(F(")"));
 		}
@@ -72,10 +365,44 @@ bool LiquidLine::set_focusPosition(Position position,
 	}
 }
 
+bool LiquidLine::add_variable(const void *p_variable, DataType varType) {
+	uint8_t count = 0;
+	for (uint8_t s = _variables; s != NO_SLOT; s = slot[s].next) {
+		count++;
+	}
+	if (count == MAX_VARIABLES) {
+		DEBUGLN(F(" failed, edit LiquidMenu_config.h to allow for more variables"));
+		return false;
+	}
+	if (append_slot(_variables, p_variable, (uint8_t)varType)) {
+		DEBUGLN(F(""));
+		if (((uint8_t)varType > (uint8_t)DataType::FIRST_GETTER)
+		    && (p_variable != nullptr)
+		    && (find_getterCache(p_variable, true) == nullptr)) {
+			DEBUGLN(F("Caching a getter failed, edit LiquidMenu_config.h to allow for more getter caches"));
+			if (missingGetterCaches < 0xFF) {
+				missingGetterCaches++;
+			}
+		}
+		return true;
+	} else {
+		DEBUGLN(F(" failed, edit LiquidMenu_config.h to allow for more line slots"));
+		return false;
+	}
+}
+
+uint8_t LiquidLine::find_variable(uint8_t number) const {
+	uint8_t s = _variables;
+	for (uint8_t v = 1; (v < number) && (s != NO_SLOT); v++) {
+		s = slot[s].next;
+	}
+	return (number == 0) ? NO_SLOT : s;
+}
+
 bool LiquidLine::set_asGlyph(uint8_t number) {
-	uint8_t index = number - 1;
-	if ( (index < MAX_VARIABLES) && (_variableType[index] == DataType::UINT8_T) ) {
-		_variableType[index] = DataType::GLYPH;
+	uint8_t s = find_variable(number);
+	if ((s != NO_SLOT) && (slot[s].tag == (uint8_t)DataType::UINT8_T)) {
+		slot[s].tag = (uint8_t)DataType::GLYPH;
 		return true;
 	} else {
 		DEBUG(F("Setting variable ")); DEBUG(number);
@@ -85,9 +412,9 @@ bool LiquidLine::set_asGlyph(uint8_t number) {
 }
 
 bool LiquidLine::set_asProgmem(uint8_t number) {
-	uint8_t index = number - 1;
-	if ((index < MAX_VARIABLES) && (_variableType[index] == DataType::CONST_CHAR_PTR)) {
-		_variableType[index] = DataType::PROG_CONST_CHAR_PTR;
+	uint8_t s = find_variable(number);
+	if ((s != NO_SLOT) && (slot[s].tag == (uint8_t)DataType::CONST_CHAR_PTR)) {
+		slot[s].tag = (uint8_t)DataType::PROG_CONST_CHAR_PTR;
 		return true;
 	} else {
 		DEBUG(F("Setting variable ")); DEBUG(number);
@@ -96,36 +423,143 @@ bool LiquidLine::set_asProgmem(uint8_t number) {
 	}
 }
 
-void LiquidLine::print(DisplayClass *p_liquidCrystal, bool isFocused) {
-	p_liquidCrystal->setCursor(_column, _row);
+bool LiquidLineBase::query_getters() {
+	return false;
+}
+
+bool LiquidLineBase::query_getter(const void *p_getter, DataType getterType) {
+	if (p_getter == nullptr) {
+		return false;
+	}
+	if (find_getterCache(p_getter, true) == nullptr) {
+		return true;
+	}
+	bool changed;
+	LiquidGetterValue value;
+	read_getter(p_getter, getterType, value, changed);
+	return changed;
+}
+
+void LiquidLineBase::hold_getters(bool hold) {
+	getterHold = hold;
+}
+
+bool LiquidLine::set_fieldWidth(uint8_t number, uint8_t width, Align align) {
+	uint8_t s = find_variable(number);
+	if (s == NO_SLOT) {
+		DEBUG(F("Setting the field of variable ")); DEBUG(number);
+		DEBUGLN(F(" failed, there is no such variable"));
+		return false;
+	}
+	slot[s].field = fit_coordinate(width, FIELD_WIDTH_MASK) | ((uint8_t)align << 6);
+	return true;
+}
+
+bool LiquidLine::set_getterInterval(uint16_t interval) {
+	bool cached = true;
+	for (uint8_t s = _variables; s != NO_SLOT; s = slot[s].next) {
+		if ((slot[s].tag > (uint8_t)DataType::FIRST_GETTER)
+		    && (slot[s].p_item != nullptr)) {
+			// The getters refused an entry were counted when they were added.
+			LiquidGetterCache *p_entry = find_getterCache(slot[s].p_item, true);
+			if (p_entry == nullptr) {
+				cached = false;
+				continue;
+			}
+			p_entry->interval = interval;
+		}
+	}
+	return cached;
+}
+
+uint8_t LiquidLine::get_missingGetterCaches() {
+	return missingGetterCaches;
+}
+
+bool LiquidLine::query_getters() {
+	bool changed = false;
+	for (uint8_t s = _variables; s != NO_SLOT; s = slot[s].next) {
+		if ((slot[s].tag > (uint8_t)DataType::FIRST_GETTER)
+		    && query_getter(slot[s].p_item, (DataType)slot[s].tag)) {
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+bool LiquidLineBase::set_refreshPeriod(uint16_t period) {
+	const void *p_period = reinterpret_cast<const void*>((uintptr_t)period);
+	for (uint8_t s = _functions; s != NO_SLOT; s = slot[s].next) {
+		if (slot[s].tag == REFRESH_PERIOD_TAG) {
+			slot[s].p_item = p_period;
+			return true;
+		}
+	}
+	if ((period == 0) || append_slot(_functions, p_period, REFRESH_PERIOD_TAG)) {
+		return true;
+	} else {
+		DEBUGLN(F("Setting the refresh period failed, edit LiquidMenu_config.h to allow for more line slots"));
+		return false;
+	}
+}
+
+bool LiquidLineBase::schedule_refresh(uint32_t now, uint32_t elapsed,
+                                      uint16_t &wait) {
+	uint16_t period = 0;
+	for (uint8_t s = _functions; s != NO_SLOT; s = slot[s].next) {
+		if (slot[s].tag == REFRESH_PERIOD_TAG) {
+			period = (uint16_t)reinterpret_cast<uintptr_t>(slot[s].p_item);
+			break;
+		}
+	}
+	if (period == 0) {
+		return false;
+	}
+	// The last multiple of the period is `now - phase`, it was crossed if
+	// it's after the previous check. The difference `elapsed` is correct
+	// across the rollover of `millis()`, where one period comes out
+	// shorter.
+	const uint16_t phase = now % period;
+	if (elapsed > phase) {
+		_refreshDue = true;
+	}
+	const uint16_t remaining = period - phase;
+	if (remaining < wait) {
+		wait = remaining;
+	}
+	return _refreshDue;
+}
+
+void LiquidLineBase::print(LiquidFrame *p_frame, bool isFocused) {
+	p_frame->begin_line(_refreshDue);
+	_refreshDue = false;
+	p_frame->setCursor(_column, _row);
 	DEBUG(F(" (")); DEBUG(_column); DEBUG(F(", ")); DEBUG(_row); DEBUGLN(F(")"));
 
 	DEBUG(F("|\t"));
-	for (uint8_t v = 0; v < MAX_VARIABLES; v++) {
-		print_variable(p_liquidCrystal, v);
-	}
+	print_variables(p_frame);
 	DEBUGLN();
 
 	if (isFocused) {
 		DEBUG(F("\t\t<Focus position: "));
-		switch (_focusPosition) {
+		switch ((Position)_focusPosition) {
 		case Position::RIGHT: {
-			p_liquidCrystal->write((uint8_t)15);
+			p_frame->write_focusGlyph(Position::RIGHT);
 			DEBUGLN(F("right>"));
-			//p_liquidCrystal->print(NOTHING);
+			//p_frame->print(NOTHING);
 			break;
 		} //case RIGHT
 		case Position::LEFT: {
-			//p_liquidCrystal->print(NOTHING);
-			p_liquidCrystal->setCursor(_column - 1, _row);
-			p_liquidCrystal->write((uint8_t)14);
+			//p_frame->print(NOTHING);
+			p_frame->setCursor(_column - 1, _row);
+			p_frame->write_focusGlyph(Position::LEFT);
 			DEBUGLN(F("left>"));
 			break;
 		} //case LEFT
 		case Position::CUSTOM: {
-			//p_liquidCrystal->print(NOTHING);
-			p_liquidCrystal->setCursor(_focusColumn, _focusRow);
-			p_liquidCrystal->write((uint8_t)13);
+			//p_frame->print(NOTHING);
+			p_frame->setCursor(_focusColumn, _focusRow);
+			p_frame->write_focusGlyph(Position::CUSTOM);
 			DEBUGLN(F("custom (")); DEBUG(_focusColumn);
 			DEBUG(F(", ")); DEBUG(_focusRow); DEBUGLN(F(")>"));
 			break;
@@ -133,258 +567,186 @@ void LiquidLine::print(DisplayClass *p_liquidCrystal, bool isFocused) {
 		default: {
 			DEBUG(F("invalid (")); DEBUG((uint8_t)_focusPosition);
 			DEBUGLN(F("), switching to default>"));
-			_focusPosition = Position::NORMAL;
-			p_liquidCrystal->write((uint8_t)15);
-			//p_liquidCrystal->print(NOTHING);
+			_focusPosition = (uint8_t)Position::NORMAL;
+			p_frame->write_focusGlyph(Position::NORMAL);
+			//p_frame->print(NOTHING);
 			break;
 		} //default
 		} //switch (_focusPosition)
 	} else {
-		//p_liquidCrystal->print(NOTHING);
+		//p_frame->print(NOTHING);
 	}
+	p_frame->end_line();
 }
 
-void LiquidLine::print_variable(DisplayClass *p_liquidCrystal, uint8_t number) {
-	switch (_variableType[number]) {
+void LiquidLine::print_variables(LiquidFrame *p_frame) {
+	for (uint8_t s = _variables; s != NO_SLOT; s = slot[s].next) {
+		p_frame->begin_variable();
+		const uint8_t width = slot[s].field & FIELD_WIDTH_MASK;
+		if (width > 0) {
+			p_frame->begin_field(width, (Align)(slot[s].field >> 6));
+		}
+		print_variable(p_frame, slot[s].p_item, (DataType)slot[s].tag,
+		               _floatDecimalPlaces);
+		if (width > 0) {
+			p_frame->end_field();
+		}
+	}
+}
+
+void LiquidLineBase::print_variable(LiquidFrame *p_frame, const void *p_variable,
+                                    DataType varType, uint8_t decimalPlaces) {
+	switch (varType) {
 	    // Variables -----
 		case DataType::CONST_CHAR_PTR: {
-			const char* variable = reinterpret_cast<const char*>(_variable[number]);
+			const char* variable = reinterpret_cast<const char*>(p_variable);
 			DEBUG(F("(const char*)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print(variable);
 			break;
 		} //case CONST_CHAR_PTR
 		case DataType::CHAR_PTR: {
-			char* variable = const_cast<char*>(reinterpret_cast<const char *>(_variable[number]));
+			char* variable = const_cast<char*>(reinterpret_cast<const char *>(p_variable));
 			DEBUG(F("(char*)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print(variable);
 			break;
 		} //case CHAR_PTR
 		case DataType::CHAR: {
-			const char variable = *static_cast<const char*>(_variable[number]);
+			const char variable = *static_cast<const char*>(p_variable);
 			DEBUG(F("(char)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print(variable);
 			break;
 		} //case CHAR
 
 		case DataType::INT8_T: {
-			const int8_t variable = *static_cast<const int8_t*>(_variable[number]);
+			const int8_t variable = *static_cast<const int8_t*>(p_variable);
 			DEBUG(F("(int8_t)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print_signed(variable);
 			break;
 		} //case INT8_T
 		case DataType::UINT8_T: {
-			const uint8_t variable = *static_cast<const uint8_t*>(_variable[number]);
+			const uint8_t variable = *static_cast<const uint8_t*>(p_variable);
 			DEBUG(F("(uint8_t)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print_unsigned(variable);
 			break;
 		} //case UINT8_T
 
 		case DataType::INT16_T: {
-			const int16_t variable = *static_cast<const int16_t*>(_variable[number]);
+			const int16_t variable = *static_cast<const int16_t*>(p_variable);
 			DEBUG(F("(int16_t)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print_signed(variable);
 			break;
 		} //case INT16_T
 		case DataType::UINT16_T: {
-			const uint16_t variable = *static_cast<const uint16_t*>(_variable[number]);
+			const uint16_t variable = *static_cast<const uint16_t*>(p_variable);
 			DEBUG(F("(uint16_t)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print_unsigned(variable);
 			break;
 		} //case UINT16_T
 
 		case DataType::INT32_T: {
-			const int32_t variable = *static_cast<const int32_t*>(_variable[number]);
+			const int32_t variable = *static_cast<const int32_t*>(p_variable);
 			DEBUG(F("(int32_t)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print_signed(variable);
 			break;
 		} //case INT32_T
 		case DataType::UINT32_T: {
-			const uint32_t variable = *static_cast<const uint32_t*>(_variable[number]);
+			const uint32_t variable = *static_cast<const uint32_t*>(p_variable);
 			DEBUG(F("(uint32_t)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print_unsigned(variable);
 			break;
 		} //case UINT32_T
 
 		case DataType::FLOAT: {
-			const float variable = *static_cast<const float*>(_variable[number]);
+			const float variable = *static_cast<const float*>(p_variable);
 			DEBUG(F("(float)")); DEBUG(variable);
-			p_liquidCrystal->print(variable, _floatDecimalPlaces);
+			p_frame->print_float(variable, decimalPlaces);
 			break;
 		} //case FLOAT
 
 		case DataType::DOUBLE: {
-			const double variable = *static_cast<const double*>(_variable[number]);
+			const double variable = *static_cast<const double*>(p_variable);
 			DEBUG(F("(double)")); DEBUG(variable);
-			p_liquidCrystal->print(variable, _floatDecimalPlaces);
+			p_frame->print_float(variable, decimalPlaces);
 			break;
 		} //case DOUBLE
 
 		case DataType::BOOL: {
-			const bool variable = *static_cast<const bool*>(_variable[number]);
+			const bool variable = *static_cast<const bool*>(p_variable);
 			DEBUG(F("(bool)")); DEBUG(variable);
-			p_liquidCrystal->print(variable);
+			p_frame->print(variable);
 			break;
 		} //case BOOL
 
 		case DataType::GLYPH: {
-			const uint8_t variable = *static_cast<const uint8_t*>(_variable[number]);
+			const uint8_t variable = *static_cast<const uint8_t*>(p_variable);
 			DEBUG(F("(glyph)")); DEBUG(variable);
-			p_liquidCrystal->write((uint8_t)variable);
+			p_frame->write_glyphIndex(variable);
 			break;
-		} //case BOOL
+		} //case GLYPH
+
+		case DataType::GLYPH_BITMAP: {
+			uint8_t* variable = const_cast<uint8_t*>(static_cast<const uint8_t*>(p_variable));
+			DEBUG(F("(glyph bitmap)"));
+			p_frame->write_glyph(variable);
+			break;
+		} //case GLYPH_BITMAP
 
 		case DataType::PROG_CONST_CHAR_PTR: {
-			const char* variable = reinterpret_cast<const char*>(_variable[number]);
-			volatile const int len = strlen_P(variable);
-			char buffer[len];
-			for (uint8_t i = 0; i < len; i++) {
-				buffer[i] = pgm_read_byte_near(variable + i);
-			}
-			buffer[len] = '\0';
-			DEBUG(F("(const char*)")); DEBUG(buffer);
-			p_liquidCrystal->print(buffer);
+			const char* variable = reinterpret_cast<const char*>(p_variable);
+			DEBUG(F("(const char*)")); DEBUG(reinterpret_cast<const __FlashStringHelper*>(variable));
+			p_frame->print_progmem(variable);
 			break;
 		} //case PROG_CONST_CHAR_PTR
 	    // ~Variables -----
 
 	    // Getter functions -----
-		case DataType::CONST_CHAR_PTR_GETTER: {
-			const constcharPtrFnPtr getterFunction = reinterpret_cast<constcharPtrFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				const char * variable = (getterFunction)();
-			    DEBUG(F("(const char*)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case CONST_CHAR_PTR_GETTER
-
-		case DataType::CHAR_PTR_GETTER: {
-			const charPtrFnPtr getterFunction = reinterpret_cast<charPtrFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				char* variable = (getterFunction)();
-				DEBUG(F("(char*)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case CHAR_PTR_GETTER
-
-		case DataType::CHAR_GETTER: {
-			const charFnPtr getterFunction = reinterpret_cast<charFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				char variable = (getterFunction)();
-				DEBUG(F("(char)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case CHAR_GETTER
-
-		case DataType::INT8_T_GETTER: {
-			const int8tFnPtr getterFunction = reinterpret_cast<int8tFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				int8_t variable = (getterFunction)();
-				DEBUG(F("(int8_t)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case INT8_T_GETTER
-
-		case DataType::UINT8_T_GETTER: {
-			const uint8tFnPtr getterFunction = reinterpret_cast<uint8tFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				uint8_t variable = (getterFunction)();
-				DEBUG(F("(uint8_t)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case UINT8_T_GETTER
-
-		case DataType::INT16_T_GETTER: {
-			const int16tFnPtr getterFunction = reinterpret_cast<int16tFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				int16_t variable = (getterFunction)();
-				DEBUG(F("(int16_t)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case INT16_T_GETTER
-
-		case DataType::UINT16_T_GETTER: {
-			const uint16tFnPtr getterFunction = reinterpret_cast<uint16tFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				uint16_t variable = (getterFunction)();
-				DEBUG(F("(uint16_t)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case UINT16_T_GETTER
-
-		case DataType::INT32_T_GETTER: {
-			const int32tFnPtr getterFunction = reinterpret_cast<int32tFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				int32_t variable = (getterFunction)();
-				DEBUG(F("(int32_t)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case INT32_T_GETTER
-
-		case DataType::UINT32_T_GETTER: {
-			const uint32tFnPtr getterFunction = reinterpret_cast<uint32tFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				uint32_t variable = (getterFunction)();
-				DEBUG(F("(uint32_t)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
-			break;
-		} // case UINT32_T_GETTER
-
-		case DataType::FLOAT_GETTER: {
-			const floatFnPtr getterFunction = reinterpret_cast<floatFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				const float variable = (getterFunction)();
-				DEBUG(F("(float)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			}
-			break;
-		} // case FLOAT_GETTER
-
-		case DataType::DOUBLE_GETTER: {
-			const doubleFnPtr getterFunction = reinterpret_cast<doubleFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				const double variable = (getterFunction)();
-				DEBUG(F("(double)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			}
-			break;
-		} // case DOUBLE_GETTER
-
+		case DataType::CONST_CHAR_PTR_GETTER:
+		case DataType::CHAR_PTR_GETTER:
+		case DataType::CHAR_GETTER:
+		case DataType::INT8_T_GETTER:
+		case DataType::UINT8_T_GETTER:
+		case DataType::INT16_T_GETTER:
+		case DataType::UINT16_T_GETTER:
+		case DataType::INT32_T_GETTER:
+		case DataType::UINT32_T_GETTER:
+		case DataType::FLOAT_GETTER:
+		case DataType::DOUBLE_GETTER:
 		case DataType::BOOL_GETTER: {
-			const boolFnPtr getterFunction = reinterpret_cast<boolFnPtr>(_variable[number]);
-			if (getterFunction != nullptr) {
-				bool variable = (getterFunction)();
-				DEBUG(F("(bool)")); DEBUG(variable);
-				p_liquidCrystal->print(variable);
-			} 
+			bool changed;
+			LiquidGetterValue value;
+			const DataType type = read_getter(p_variable, varType, value, changed);
+			DEBUG(F("(getter)"));
+			if ((type == DataType::CONST_CHAR_PTR) || (type == DataType::CHAR_PTR)) {
+				print_variable(p_frame, value.text, type, decimalPlaces);
+			} else if (type != DataType::NOT_USED) {
+				print_variable(p_frame, &value, type, decimalPlaces);
+			}
 			break;
-		} // case BOOL_GETTER
+		} // case *_GETTER
 	    // ~Getter functions -----
 
 		default: { break; }
-	} //switch (_variableType)
+	} //switch (varType)
 
 	DEBUG(F(" "));
 }
 
-bool LiquidLine::is_callable(uint8_t number) const {
-	if (_function[number - 1]) return true;
-	else return false;
+bool LiquidLineBase::is_callable(uint8_t number) const {
+	for (uint8_t s = _functions; s != NO_SLOT; s = slot[s].next) {
+		if (slot[s].tag == number) {
+			return slot[s].p_item != nullptr;
+		}
+	}
+	return false;
 }
 
-bool LiquidLine::call_function(uint8_t number) const {
-	if (_function[number - 1]) {
-		(*_function[number - 1])();
-		return true;
-	} else {
-		return false;
+bool LiquidLineBase::call_function(uint8_t number) const {
+	for (uint8_t s = _functions; s != NO_SLOT; s = slot[s].next) {
+		if ((slot[s].tag == number) && (slot[s].p_item != nullptr)) {
+			typedef void (*functionPtr)(void);
+			(*reinterpret_cast<functionPtr>(slot[s].p_item))();
+			return true;
+		}
 	}
+	return false;
 }
@@ -0,0 +1,174 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Vasil Kalchev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/**
+@file
+Contains the LiquidListScreen class definition.
+*/
+
+#include "LiquidMenu.h"
+
+/// Hides the focus for one step after the last item, like the other screens.
+static const bool FOCUS_GHOSTING = (LM_FOCUS_INDICATOR_GHOSTING == true);
+
+
+LiquidListLine::LiquidListLine(void (*provider)(uint16_t index, Print &output),
+                               uint8_t column)
+	: LiquidLineBase(column, 0), _provider(provider), _item(0) {}
+
+void LiquidListLine::print_variables(LiquidFrame *p_frame) {
+	if (_provider != nullptr) {
+		DEBUG(F("(item ")); DEBUG(_item); DEBUG(F(")"));
+		_provider(_item, *p_frame);
+	}
+}
+
+
+LiquidListScreen::LiquidListScreen(void (*provider)(uint16_t index, Print &output),
+                                   uint16_t itemCount, uint8_t rows, uint8_t column,
+                                   uint8_t row)
+	: LiquidScreenBase(nullptr, 0, nullptr, 0), _line(provider, column),
+	  _p_header(nullptr), _itemCount(itemCount), _firstItem(0),
+	  _focusedItem(NO_ITEM), _rows(rows), _firstRow(row) {
+	update_window();
+}
+
+bool LiquidListScreen::attach_function(uint8_t number, void (*function)(void)) {
+	return _line.attach_function(number, function);
+}
+
+void LiquidListScreen::set_header(LiquidLineBase &header) {
+	_p_header = &header;
+	update_window();
+}
+
+void LiquidListScreen::set_itemCount(uint16_t itemCount) {
+	_itemCount = itemCount;
+	if ((_focusedItem != NO_ITEM) && (_focusedItem >= _itemCount)) {
+		_focusedItem = NO_ITEM;
+	}
+	update_window();
+}
+
+uint16_t LiquidListScreen::get_itemCount() const {
+	return _itemCount;
+}
+
+void LiquidListScreen::set_displayLineCount(uint8_t rows) {
+	_rows = rows;
+	update_window();
+}
+
+bool LiquidListScreen::set_focusedItem(uint16_t index) {
+	if ((index >= _itemCount) || !_line._focusable) {
+		return false;
+	}
+	_focusedItem = index;
+	update_window();
+	return true;
+}
+
+uint16_t LiquidListScreen::get_focusedItem() const {
+	return _focusedItem;
+}
+
+uint16_t LiquidListScreen::get_firstItem() const {
+	return _firstItem;
+}
+
+void LiquidListScreen::switch_focus(bool forward) {
+	DEBUG(F("LListScreen ")); print_me(reinterpret_cast<uintptr_t>(this));
+
+	if (!_line._focusable || (_itemCount == 0)) {
+		// Nothing is focusable, the focus stays hidden.
+		_focusedItem = NO_ITEM;
+	} else if (forward) {
+		if (_focusedItem == NO_ITEM) {
+			_focusedItem = 0;
+		} else if (_focusedItem + 1 < _itemCount) {
+			_focusedItem++;
+		} else {
+			_focusedItem = FOCUS_GHOSTING ? NO_ITEM : 0;
+		}
+	} else {
+		if (_focusedItem == NO_ITEM) {
+			_focusedItem = _itemCount - 1;
+		} else if (_focusedItem > 0) {
+			_focusedItem--;
+		} else {
+			_focusedItem = FOCUS_GHOSTING ? NO_ITEM : _itemCount - 1;
+		}
+	}
+	update_window();
+
+	DEBUG(F("Focus switched to item ")); DEBUGLN(_focusedItem);
+}
+
+bool LiquidListScreen::set_focusedLine(uint8_t lineIndex) {
+	const uint8_t headerCount = get_headerCount();
+	if ((lineIndex >= headerCount) && (lineIndex - headerCount < _rows)) {
+		return set_focusedItem(_firstItem + lineIndex - headerCount);
+	}
+	return false;
+}
+
+LiquidLineBase* LiquidListScreen::get_line(uint8_t index) const {
+	const uint8_t headerCount = get_headerCount();
+	if (index < headerCount) {
+		return _p_header;
+	}
+	const uint8_t row = index - headerCount;
+	_line._item = _firstItem + row;
+	_line.set_position(_line._column, _firstRow + row);
+	return &_line;
+}
+
+uint8_t LiquidListScreen::get_headerCount() const {
+	return (_p_header != nullptr) ? 1 : 0;
+}
+
+void LiquidListScreen::update_window() {
+	const uint8_t visibleRows = (_itemCount < _rows) ? _itemCount : _rows;
+	if (_focusedItem != NO_ITEM) {
+		if (_focusedItem < _firstItem) {
+			_firstItem = _focusedItem;
+		} else if (_focusedItem - _firstItem >= _rows) {
+			_firstItem = _focusedItem - _rows + 1;
+		}
+	}
+	// The last rows are never left empty while there are items before them.
+	if (_firstItem > _itemCount - visibleRows) {
+		_firstItem = _itemCount - visibleRows;
+	}
+	const uint8_t headerCount = get_headerCount();
+	set_lineCount(headerCount + visibleRows);
+	// The focus is hidden after the last line while no item is focused,
+	// e.g. when it was "ghosted" after the last item.
+	if (_focusedItem != NO_ITEM) {
+		set_focus(headerCount + _focusedItem - _firstItem);
+	} else {
+		set_focus(headerCount + visibleRows);
+	}
+}
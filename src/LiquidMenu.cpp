@@ -24,9 +24,11 @@ SOFTWARE.
 
 /**
 @file
-Contains the LiquidMenu class definition.
+Contains the LiquidMenuBase and LiquidMenu class definitions.
 */
 
+#include <Arduino.h>
+
 #include "LiquidMenu.h"
 #include "glyphs.h"
 
@@ -39,46 +41,180 @@ void print_me(uintptr_t address) {
 
 const uint8_t DIVISION_LINE_LENGTH = 40; ///< Sets the length of the division line.
 
-LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, uint8_t startingScreen)
-  : _p_liquidCrystal(&liquidCrystal), _screenCount(0),
-    _currentScreen(startingScreen - 1) {
+/// The frame into which the current screen is printed before flushing.
+static LiquidFrame frame;
+
+/// Checks if the time budget of an update has run out.
+/**
+@param startTime - when the update started in microseconds
+@param budget - the time budget in microseconds, 0 for no limit
+@returns true if the time budget has run out
+*/
+static bool is_overBudget(uint32_t startTime, uint32_t budget) {
+  return (budget != 0) && (micros() - startTime >= budget);
 }
 
-LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, LiquidScreen &liquidScreen,
+/// The first menu of the list of all menus, the menus built for the same
+/// display are found in it.
+static LiquidMenuBase *firstMenu = nullptr;
+
+LiquidDisplay::LiquidDisplay(LiquidDisplayDriver &driver)
+  : _p_driver(&driver), _columns(0), _rows(0), _cursor(NO_CURSOR) {
+  memset(_shadow, ' ', sizeof(_shadow));
+}
+
+bool LiquidDisplay::set_size(uint8_t columns, uint8_t rows) {
+  _columns = columns;
+  _rows = (rows > 4) ? 4 : rows;
+  _cursor = NO_CURSOR;
+  if ((columns > MAX_COLUMNS) || (_rows > MAX_ROWS)) {
+    DEBUGLN(F("The display is larger than the frame, edit LiquidMenu_config.h to allow for more columns and rows"));
+    return false;
+  }
+  return true;
+}
+
+void LiquidDisplay::adopt_state(const LiquidDisplay &other) {
+  memcpy(_shadow, other._shadow, sizeof(_shadow));
+  _glyphSlots = other._glyphSlots;
+  _columns = other._columns;
+  _rows = other._rows;
+  _cursor = other._cursor;
+}
+
+uint16_t LiquidDisplay::get_address(uint8_t row, uint8_t column) const {
+  if (_rows == 0) {
+    return (row << 8) | column;
+  }
+  // The rows 2 and 3 continue the rows 0 and 1.
+  return ((row & 0x1) ? 0x40 : 0x00) + ((row & 0x2) ? _columns : 0) + column;
+}
+
+void LiquidDisplay::advance_cursor(uint8_t count) {
+  _cursor += count;
+  if (_rows == 1) {
+    if (_cursor >= 0x50) {
+      _cursor -= 0x50;
+    }
+  } else if (_rows > 1) {
+    // Each of the two lines of the memory is 40 characters long.
+    if ((_cursor >= 0x28) && (_cursor < 0x40)) {
+      _cursor += 0x40 - 0x28;
+    } else if (_cursor >= 0x68) {
+      _cursor -= 0x68;
+    }
+  }
+}
+
+LiquidMenuBase::LiquidMenuBase(DisplayClass &liquidCrystal,
+                               LiquidScreenBase **p_liquidScreen,
+                               uint8_t *p_shownBits, uint8_t screenCapacity,
+                               uint8_t startingScreen)
+  : LiquidMenuBase(&liquidCrystal, nullptr, p_liquidScreen, p_shownBits,
+                   screenCapacity, startingScreen) {}
+
+LiquidMenuBase::LiquidMenuBase(LiquidDisplayDriver &driver,
+                               LiquidScreenBase **p_liquidScreen,
+                               uint8_t *p_shownBits, uint8_t screenCapacity,
+                               uint8_t startingScreen)
+  : LiquidMenuBase(nullptr, &driver, p_liquidScreen, p_shownBits,
+                   screenCapacity, startingScreen) {}
+
+LiquidMenuBase::LiquidMenuBase(DisplayClass *p_liquidCrystal,
+                               LiquidDisplayDriver *p_driver,
+                               LiquidScreenBase **p_liquidScreen,
+                               uint8_t *p_shownBits, uint8_t screenCapacity,
+                               uint8_t startingScreen)
+  : _display((p_driver != nullptr) ? *p_driver : _ownDriver),
+    _p_display(&_display), _mirrorCount(0), _p_liquidScreen(p_liquidScreen),
+    _screenCapacity(screenCapacity), _screenCount(0),
+    _currentScreen(startingScreen - 1),
+    _shownScreens(p_shownBits, screenCapacity),
+    _hiddenSync(LiquidScreenBase::_hiddenChanges), _clearOnUpdate(true),
+    _deferredUpdate(false), _stale(false), _clearPending(false),
+    _reservedGlyphs(0), _lastTick(0), _ticking(false) {
+  reset_stats();
+  _p_focusGlyph[(uint8_t)Position::RIGHT - 1] = glyph::rightFocus;
+  _p_focusGlyph[(uint8_t)Position::LEFT - 1] = glyph::leftFocus;
+  _p_focusGlyph[(uint8_t)Position::CUSTOM - 1] = glyph::customFocus;
+  _ownDriver._p_display = p_liquidCrystal;
+  join_menus();
+}
+
+LiquidMenuBase::LiquidMenuBase(const LiquidMenuBase &other,
+                               LiquidScreenBase **p_liquidScreen,
+                               uint8_t *p_shownBits)
+  : _ownDriver(other._ownDriver), _display(other._display),
+    _p_display(&_display), _mirrorCount(other._mirrorCount), _p_liquidScreen(p_liquidScreen),
+    _screenCapacity(other._screenCapacity), _screenCount(other._screenCount),
+    _currentScreen(other._currentScreen),
+    _shownScreens(p_shownBits, other._screenCapacity),
+    _hiddenSync(other._hiddenSync), _clearOnUpdate(other._clearOnUpdate),
+    _deferredUpdate(other._deferredUpdate), _stale(other._stale),
+    _clearPending(other._clearPending), _stats(other._stats),
+    _reservedGlyphs(other._reservedGlyphs), _lastTick(other._lastTick),
+    _ticking(other._ticking) {
+  // The copy drives the display through its own copy of the driver and
+  // shares what it shows with the copied menu.
+  if (other._display._p_driver == &other._ownDriver) {
+    _display._p_driver = &_ownDriver;
+  }
+  join_menus();
+  memcpy(_p_liquidScreen, other._p_liquidScreen,
+         _screenCount * sizeof(_p_liquidScreen[0]));
+  _shownScreens.copy(other._shownScreens);
+  memcpy(_p_mirror, other._p_mirror, sizeof(_p_mirror));
+  memcpy(_p_focusGlyph, other._p_focusGlyph, sizeof(_p_focusGlyph));
+}
+
+
+LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, uint8_t startingScreen)
+  : LiquidMenuBase(liquidCrystal, _liquidScreen, _shownBits, MAX_SCREENS,
+                   startingScreen) {}
+
+LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen,
                        uint8_t startingScreen)
   : LiquidMenu(liquidCrystal, startingScreen) {
   add_screen(liquidScreen);
 }
 
-LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, LiquidScreen &liquidScreen1,
-                       LiquidScreen &liquidScreen2, uint8_t startingScreen)
+LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen1,
+                       LiquidScreenBase &liquidScreen2, uint8_t startingScreen)
   : LiquidMenu(liquidCrystal, liquidScreen1, startingScreen) {
   add_screen(liquidScreen2);
 }
 
-LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, LiquidScreen &liquidScreen1,
-                       LiquidScreen &liquidScreen2, LiquidScreen &liquidScreen3,
+LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen1,
+                       LiquidScreenBase &liquidScreen2, LiquidScreenBase &liquidScreen3,
                        uint8_t startingScreen)
   : LiquidMenu(liquidCrystal, liquidScreen1, liquidScreen2, startingScreen) {
   add_screen(liquidScreen3);
 }
 
-LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, LiquidScreen &liquidScreen1,
-                       LiquidScreen &liquidScreen2, LiquidScreen &liquidScreen3,
-                       LiquidScreen &liquidScreen4, uint8_t startingScreen)
+LiquidMenu::LiquidMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen1,
+                       LiquidScreenBase &liquidScreen2, LiquidScreenBase &liquidScreen3,
+                       LiquidScreenBase &liquidScreen4, uint8_t startingScreen)
   : LiquidMenu(liquidCrystal, liquidScreen1, liquidScreen2, liquidScreen3,
                startingScreen) {
   add_screen(liquidScreen4);
 }
 
-bool LiquidMenu::add_screen(LiquidScreen &liquidScreen) {
+LiquidMenu::LiquidMenu(LiquidDisplayDriver &driver, uint8_t startingScreen)
+  : LiquidMenuBase(driver, _liquidScreen, _shownBits, MAX_SCREENS,
+                   startingScreen) {}
+
+LiquidMenu::LiquidMenu(const LiquidMenu &other)
+  : LiquidMenuBase(other, _liquidScreen, _shownBits) {}
+
+bool LiquidMenuBase::add_screen(LiquidScreenBase &liquidScreen) {
   DEBUG(F("LMenu ")); print_me(reinterpret_cast<uintptr_t>(this));
 
   DEBUG(F("Add screen (0x")); DEBUG((uintptr_t)&liquidScreen);
   DEBUG(F(") count(")) DEBUG(_screenCount); DEBUG(F(")"));
 
-  if (_screenCount < MAX_SCREENS) {
+  if (_screenCount < _screenCapacity) {
     _p_liquidScreen[_screenCount] = &liquidScreen;
+    _shownScreens.set(_screenCount, !liquidScreen._hidden);
     _screenCount++;
 
     DEBUGLN(F(""));
@@ -88,57 +224,142 @@ bool LiquidMenu::add_screen(LiquidScreen &liquidScreen) {
   return false;
 }
 
-LiquidScreen* LiquidMenu::get_currentScreen() const {
+bool LiquidMenuBase::add_display(LiquidDisplay &display) {
+  DEBUG(F("LMenu ")); print_me(reinterpret_cast<uintptr_t>(this));
+
+  DEBUG(F("Add display (0x")); DEBUG((uintptr_t)&display);
+  DEBUG(F(") count(")) DEBUG(_mirrorCount); DEBUG(F(")"));
+
+  if (_mirrorCount < MAX_MIRRORS) {
+    _p_mirror[_mirrorCount] = &display;
+    _mirrorCount++;
+
+    DEBUGLN(F(""));
+    return true;
+  }
+  DEBUGLN(F(" failed, edit LiquidMenu_config.h to allow for more displays"));
+  return false;
+}
+
+bool LiquidMenuBase::set_displaySize(uint8_t columns, uint8_t rows) {
+  bool fits = true;
+  for (uint8_t d = 0; d <= _mirrorCount; d++) {
+    fits = get_display(d).set_size(columns, rows) && fits;
+  }
+  return fits;
+}
+
+LiquidMenuBase::~LiquidMenuBase() {
+  for (LiquidMenuBase **p_link = &firstMenu; *p_link != nullptr;
+       p_link = &(*p_link)->_p_nextMenu) {
+    if (*p_link == this) {
+      *p_link = _p_nextMenu;
+      break;
+    }
+  }
+  // The next menu of the display takes over what it shows, the rest of
+  // them draw on that menu's display.
+  LiquidDisplay *p_heir = nullptr;
+  for (LiquidMenuBase *p_menu = firstMenu; p_menu != nullptr;
+       p_menu = p_menu->_p_nextMenu) {
+    if (p_menu->_p_display == &_display) {
+      if (p_heir == nullptr) {
+        p_heir = &p_menu->_display;
+        p_heir->adopt_state(_display);
+      }
+      p_menu->_p_display = p_heir;
+    }
+  }
+}
+
+const void* LiquidMenuBase::get_target() const {
+  if (_display._p_driver == &_ownDriver) {
+    return _ownDriver._p_display;
+  }
+  return _display._p_driver;
+}
+
+void LiquidMenuBase::join_menus() {
+  const void *p_target = get_target();
+  for (LiquidMenuBase *p_menu = firstMenu; p_menu != nullptr;
+       p_menu = p_menu->_p_nextMenu) {
+    if (p_menu->get_target() == p_target) {
+      _p_display = p_menu->_p_display;
+      break;
+    }
+  }
+  _p_nextMenu = firstMenu;
+  firstMenu = this;
+}
+
+LiquidDisplay& LiquidMenuBase::get_display(uint8_t index) const {
+  return (index == 0) ? *_p_display : *_p_mirror[index - 1];
+}
+
+LiquidScreenBase* LiquidMenuBase::get_currentScreen() const {
   return _p_liquidScreen[_currentScreen];
 }
 
-void LiquidMenu::next_screen() {
-  _p_liquidCrystal->clear();
-  do {
-    if (_currentScreen < _screenCount - 1)  {
-      _currentScreen++;
-    } else {
-      _currentScreen = 0;
+void LiquidMenuBase::update_shownScreens() {
+  if (_hiddenSync != LiquidScreenBase::_hiddenChanges) {
+    for (uint8_t s = 0; s < _screenCount; s++) {
+      _shownScreens.set(s, !_p_liquidScreen[s]->_hidden);
     }
-  } while (_p_liquidScreen[_currentScreen]->_hidden == true);
+    _hiddenSync = LiquidScreenBase::_hiddenChanges;
+  }
+}
+
+void LiquidMenuBase::next_screen() {
+  update_shownScreens();
+  uint8_t screen = _shownScreens.find_next(_currentScreen + 1, _screenCount);
+  if (screen == _screenCount) {
+    screen = _shownScreens.find_next(0, _screenCount);
+  }
+  // When all of the screens are hidden the current one stays.
+  if (screen < _screenCount) {
+    _currentScreen = screen;
+  }
+  _ticking = false;
   update();
   DEBUG(F("Switched to the next screen (")); DEBUG(_currentScreen); DEBUG(F(")"));
 }
 
-void LiquidMenu::operator++() {
+void LiquidMenuBase::operator++() {
   next_screen();
 }
 
-void LiquidMenu::operator++(int) {
+void LiquidMenuBase::operator++(int) {
   next_screen();
 }
 
-void LiquidMenu::previous_screen() {
-  _p_liquidCrystal->clear();
-  do {
-    if (_currentScreen > 0) {
-      _currentScreen--;
-    } else {
-      _currentScreen = _screenCount - 1;
-    }
-  } while (_p_liquidScreen[_currentScreen]->_hidden == true);
+void LiquidMenuBase::previous_screen() {
+  update_shownScreens();
+  uint8_t screen = _shownScreens.find_previous(_currentScreen);
+  if (screen == _currentScreen) {
+    screen = _shownScreens.find_previous(_screenCount);
+  }
+  // When all of the screens are hidden the current one stays.
+  if (screen < _screenCount) {
+    _currentScreen = screen;
+  }
+  _ticking = false;
   update();
   DEBUG(F("Switched to the previous screen (")); DEBUG(_currentScreen); DEBUGLN(F(")"));
 }
 
-void LiquidMenu::operator--() {
+void LiquidMenuBase::operator--() {
   previous_screen();
 }
 
-void LiquidMenu::operator--(int) {
+void LiquidMenuBase::operator--(int) {
   previous_screen();
 }
 
-bool LiquidMenu::change_screen(uint8_t number) {
+bool LiquidMenuBase::change_screen(uint8_t number) {
   uint8_t index = number - 1;
   if (index <= _screenCount) {
-    _p_liquidCrystal->clear();
     _currentScreen = index;
+    _ticking = false;
     update();
     DEBUG(F("Switched to screen ("));
     DEBUG(_currentScreen); DEBUGLN(F(")"));
@@ -149,17 +370,16 @@ bool LiquidMenu::change_screen(uint8_t number) {
   }
 }
 
-bool LiquidMenu::change_screen(LiquidScreen *p_liquidScreen) {
+bool LiquidMenuBase::change_screen(LiquidScreenBase *p_liquidScreen) {
   // _p_liquidMenu[_currentMenu]->_p_liquidCrystal->clear();
   for (uint8_t s = 0; s < _screenCount; s++) {
-    _p_liquidCrystal->clear();
     if (p_liquidScreen == _p_liquidScreen[s]) {
     // if (reinterpret_cast<uintptr_t>(&p_liquidScreen) == reinterpret_cast<uintptr_t>(&(*_p_liquidScreen[s]))) {
       _currentScreen = s;
+      _ticking = false;
       update();
       DEBUG(F("Switched to screen ("));
       DEBUG(_currentScreen); DEBUGLN(F(")"));
-      update();
       return true;
     }
   }
@@ -167,29 +387,28 @@ bool LiquidMenu::change_screen(LiquidScreen *p_liquidScreen) {
   return false;
 }
 
-bool LiquidMenu::operator=(uint8_t number) {
+bool LiquidMenuBase::operator=(uint8_t number) {
   return change_screen(number);
 }
 
-bool LiquidMenu::operator=(LiquidScreen *p_liquidScreen) {
+bool LiquidMenuBase::operator=(LiquidScreenBase *p_liquidScreen) {
   return change_screen(p_liquidScreen);
 }
 
-void LiquidMenu::switch_focus(bool forward) {
-  _p_liquidCrystal->clear();
+void LiquidMenuBase::switch_focus(bool forward) {
   _p_liquidScreen[_currentScreen]->switch_focus(forward);
   update();
 }
 
-bool LiquidMenu::set_focusedLine(uint8_t lineIndex) {
+bool LiquidMenuBase::set_focusedLine(uint8_t lineIndex) {
   return _p_liquidScreen[_currentScreen]->set_focusedLine(lineIndex);
 }
 
-uint8_t LiquidMenu::get_focusedLine() const {
+uint8_t LiquidMenuBase::get_focusedLine() const {
   return _p_liquidScreen[_currentScreen]->get_focusedLine();
 }
 
-bool LiquidMenu::set_focusPosition(Position position) {
+bool LiquidMenuBase::set_focusPosition(Position position) {
   DEBUG(F("LMenu ")); print_me(reinterpret_cast<uintptr_t>(this));
 
   if (position == Position::CUSTOM) {
@@ -204,20 +423,17 @@ bool LiquidMenu::set_focusPosition(Position position) {
   }
 }
 
-bool LiquidMenu::set_focusSymbol(Position position, uint8_t symbol[8]) {
+bool LiquidMenuBase::set_focusSymbol(Position position, uint8_t symbol[8]) {
   switch (position) {
   case Position::RIGHT: {
-    _p_liquidCrystal->createChar(15, symbol);
     DEBUG(F("Right"));
     break;
   } //case RIGHT
   case Position::LEFT: {
-    _p_liquidCrystal->createChar(14, symbol);
     DEBUG(F("Left"));
     break;
   } //case LEFT
   case Position::CUSTOM: {
-    _p_liquidCrystal->createChar(13, symbol);
     DEBUG(F("Custom"));
     break;
   } //case CUSTOM
@@ -226,6 +442,12 @@ bool LiquidMenu::set_focusSymbol(Position position, uint8_t symbol[8]) {
     return false;
   } //default
   } //switch (position)
+  // The symbol may have been changed in place, so it's uploaded again.
+  for (uint8_t d = 0; d <= _mirrorCount; d++) {
+    get_display(d)._glyphSlots.forget(_p_focusGlyph[(uint8_t)position - 1]);
+    get_display(d)._glyphSlots.forget(symbol);
+  }
+  _p_focusGlyph[(uint8_t)position - 1] = symbol;
   DEBUGLN(F("Focus symbol changed to:"));
   for (uint8_t i = 0; i < 8; i++) {
     DEBUGLN2(symbol[i], BIN);
@@ -233,11 +455,23 @@ bool LiquidMenu::set_focusSymbol(Position position, uint8_t symbol[8]) {
   return true;
 }
 
-bool LiquidMenu::is_callable(uint8_t number) const {
+bool LiquidMenuBase::reserve_glyphSlot(uint8_t index) {
+  if (index >= GLYPH_SLOTS) {
+    DEBUG(F("Reserving glyph slot ")); DEBUG(index);
+    DEBUGLN(F(" failed, the slots are 0 - 7"));
+    return false;
+  }
+  // The mask is applied to every display on every frame, so it also
+  // covers the mirrors added later and survives `init()`.
+  _reservedGlyphs |= 1 << index;
+  return true;
+}
+
+bool LiquidMenuBase::is_callable(uint8_t number) const {
   return _p_liquidScreen[_currentScreen]->is_callable(number);
 }
 
-bool LiquidMenu::call_function(uint8_t number, bool refresh) const {
+bool LiquidMenuBase::call_function(uint8_t number, bool refresh) const {
   bool returnValue = _p_liquidScreen[_currentScreen]->call_function(number);
   if (refresh) {
     update();
@@ -245,42 +479,316 @@ bool LiquidMenu::call_function(uint8_t number, bool refresh) const {
   return returnValue;
 }
 
-void LiquidMenu::update() const {
-  _p_liquidCrystal->clear();
-  softUpdate();
+void LiquidMenuBase::set_clearOnUpdate(bool clear) {
+  _clearOnUpdate = clear;
+}
+
+const LiquidStats& LiquidMenuBase::get_stats() const {
+  return _stats;
 }
 
-void LiquidMenu::softUpdate() const {
-  /* TEMPORARY FIX!
-   * Calls methods on the `DisplayClass` object only after it is
-   * initialized. This makes it compatible with different
-   * "LiquidCrystal" libraries and doesn't break the current API.
-   * Will be removed for version 2.0.0 when `LiquidMenu::init()` will
-   * become mandatory.
-   */
-  static bool firstRun = true;
-  if (firstRun) {
-    firstRun = false;
-    _p_liquidCrystal->createChar(15, glyph::rightFocus);
-    _p_liquidCrystal->createChar(14, glyph::leftFocus);
-    _p_liquidCrystal->createChar(13, glyph::customFocus);
+void LiquidMenuBase::reset_stats() {
+  memset(&_stats, 0, sizeof(_stats));
+}
+
+void LiquidMenuBase::set_deferredUpdate(bool deferred) {
+  _deferredUpdate = deferred;
+}
+
+void LiquidMenuBase::update() const {
+  // The lines are constructed before `Serial` is started, the variables,
+  // functions and getters they couldn't add are reported here.
+  #if LIQUIDMENU_DEBUG
+  if (LiquidLineBase::get_missingSlots() > 0) {
+    DEBUG(F("Missing line slots: ")); DEBUG(LiquidLineBase::get_missingSlots());
+    DEBUGLN(F(", edit LiquidMenu_config.h to allow for more line slots"));
+  }
+  if (LiquidLine::get_missingGetterCaches() > 0) {
+    DEBUG(F("Missing getter caches: ")); DEBUG(LiquidLine::get_missingGetterCaches());
+    DEBUGLN(F(", edit LiquidMenu_config.h to allow for more getter caches"));
   }
+  #endif
+  if (_deferredUpdate) {
+    _stale = true;
+    _clearPending = _clearPending || _clearOnUpdate;
+    return;
+  }
+  uint32_t startTime = micros();
+  if (_clearOnUpdate) {
+    clear_display();
+  }
+  render(startTime, 0);
+}
 
+void LiquidMenuBase::softUpdate() const {
+  if (_deferredUpdate) {
+    _stale = true;
+    return;
+  }
+  render(micros(), 0);
+}
+
+bool LiquidMenuBase::poll(uint32_t budgetUs) {
+  if (!_stale) {
+    return true;
+  }
+  uint32_t startTime = micros();
+  if (_clearPending) {
+    _clearPending = false;
+    clear_display();
+  }
+  if (render(startTime, budgetUs)) {
+    _stale = false;
+  }
+  return !_stale;
+}
+
+void LiquidMenuBase::clear_display() const {
+  for (uint8_t d = 0; d <= _mirrorCount; d++) {
+    LiquidDisplay &display = get_display(d);
+    display._p_driver->clear();
+    _stats.clears++;
+    memset(display._shadow, ' ', sizeof(display._shadow));
+    display._cursor = display.get_address(0, 0);
+  }
+}
+
+bool LiquidMenuBase::render(uint32_t startTime, uint32_t budget) const {
   DEBUGLN(F("Updating the LCD"));
   for (uint8_t b = 0; b < DIVISION_LINE_LENGTH; b++) {
     DEBUG(F("-"));
   }
   DEBUGLN();
   DEBUG(F("|Screen ")); DEBUGLN(_currentScreen);
-  _p_liquidScreen[_currentScreen]->print(_p_liquidCrystal);
+  frame.clear();
+  frame._p_menu = this;
+  _p_liquidScreen[_currentScreen]->print(&frame);
+  bool finished = flush_displays(frame, startTime, budget);
+  if (finished) {
+    _stats.frames++;
+  }
+  record_renderTime(startTime);
   for (uint8_t b = 0; b < DIVISION_LINE_LENGTH; b++) {
     DEBUG(F("-"));
   }
   DEBUGLN("\n");
+  return finished;
+}
+
+void LiquidMenuBase::refresh_line(LiquidLineBase &liquidLine) const {
+  liquidLine._refreshDue = true;
+  refresh(0);
+  // The line wasn't printed if it isn't visible.
+  liquidLine._refreshDue = false;
 }
 
-void LiquidMenu::init() const {
-  _p_liquidCrystal->createChar(15, glyph::rightFocus);
-  _p_liquidCrystal->createChar(14, glyph::leftFocus);
-  _p_liquidCrystal->createChar(13, glyph::customFocus);
+void LiquidMenuBase::refresh_variable(LiquidLineBase &liquidLine,
+                                      uint8_t number) const {
+  if (number > 0) {
+    liquidLine._refreshDue = true;
+    refresh(number);
+    liquidLine._refreshDue = false;
+  }
+}
+
+uint32_t LiquidMenuBase::tick(uint32_t now) {
+  // A screen which became current was just drawn whole, its periods are
+  // counted from the first tick on it.
+  if (!_ticking) {
+    _ticking = true;
+    _lastTick = now;
+  }
+  const uint32_t elapsed = now - _lastTick;
+  _lastTick = now;
+  uint16_t wait = 0xFFFF;
+  if (_p_liquidScreen[_currentScreen]->schedule_refresh(now, elapsed, wait)) {
+    DEBUGLN(F("Refreshing the due lines"));
+    refresh(0);
+  }
+  return now + wait;
+}
+
+bool LiquidMenuBase::refresh_getters() const {
+  if (!_p_liquidScreen[_currentScreen]->mark_changedLines()) {
+    return false;
+  }
+  // The values were just read, the lines are printed without calling
+  // the getters again.
+  LiquidLineBase::hold_getters(true);
+  refresh(0);
+  LiquidLineBase::hold_getters(false);
+  return true;
+}
+
+void LiquidMenuBase::refresh(uint8_t variable) const {
+  if (_deferredUpdate) {
+    _stale = true;
+    return;
+  }
+  uint32_t startTime = micros();
+  frame.clear();
+  frame._p_menu = this;
+  frame._targeted = true;
+  frame._targetVariable = variable;
+  _p_liquidScreen[_currentScreen]->print(&frame);
+  // The whole screen is printed so that the other lines still cover the
+  // cells they own, but only the refreshed lines' cells are sent.
+  if (frame.close_region()) {
+    flush_displays(frame, startTime, 0);
+  }
+  record_renderTime(startTime);
+}
+
+void LiquidMenuBase::record_renderTime(uint32_t startTime) const {
+  _stats.lastRenderUs = micros() - startTime;
+  if (_stats.lastRenderUs > _stats.maxRenderUs) {
+    _stats.maxRenderUs = _stats.lastRenderUs;
+  }
+}
+
+bool LiquidMenuBase::flush_displays(const LiquidFrame &frame, uint32_t startTime,
+                                    uint32_t budget) const {
+  // The frame is printed once, the glyphs and the changes are resolved
+  // for every display against what it shows.
+  for (uint8_t d = 0; d <= _mirrorCount; d++) {
+    LiquidDisplay &display = get_display(d);
+    uint8_t code[GLYPH_SLOTS];
+    resolve_glyphs(frame, display, code);
+    if (!flush(frame, display, code, startTime, budget)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool LiquidMenuBase::flush(const LiquidFrame &frame, LiquidDisplay &display,
+                           const uint8_t code[], uint32_t startTime,
+                           uint32_t budget) const {
+  // At least one character is sent on every call, otherwise a budget
+  // shorter than printing the screen would never finish the update.
+  bool progress = false;
+  // The rows of an HD44780 are written in the order of its memory, so
+  // that a row continues where the previous one ended.
+  static const uint8_t HD44780_ROWS[] = {0, 2, 1, 3};
+  const uint8_t rows = display._rows ? display._rows : MAX_ROWS;
+  const uint8_t columns = (display._columns && (display._columns < MAX_COLUMNS))
+    ? display._columns : MAX_COLUMNS;
+  // Unchanged characters between two runs are rewritten when that costs
+  // less than positioning the cursor.
+  const uint8_t characterCost = display._p_driver->get_characterCost();
+  const uint8_t cursorCost = display._p_driver->get_cursorCost();
+  const uint8_t maxGap = ((characterCost > 0) && (cursorCost > 0))
+    ? (cursorCost - 1) / characterCost : 0;
+  for (uint8_t i = 0; i < rows && i < MAX_ROWS; i++) {
+    const uint8_t r = (display._rows > 2) ? HD44780_ROWS[i] : i;
+    uint8_t c = 0;
+    while (c < columns) {
+      if ((frame.get_character(r, c, code) == display._shadow[r][c])
+          || !frame.is_inRegion(r, c)) {
+        c++;
+        continue;
+      }
+      if (progress && is_overBudget(startTime, budget)) {
+        return false;
+      }
+      // The whole run of changed characters is handed to the driver at
+      // once, so that it can be sent in one burst.
+      uint8_t run[MAX_COLUMNS];
+      const uint8_t column = c;
+      uint8_t size = 0;
+      do {
+        const uint8_t character = frame.get_character(r, c, code);
+        run[size++] = character;
+        display._shadow[r][c] = character;
+        c++;
+        uint8_t gap = measure_gap(frame, display, code, r, c, columns, maxGap);
+        _stats.rewrites += gap;
+        for (; gap > 0; gap--, c++) {
+          run[size++] = display._shadow[r][c];
+        }
+      } while ((c < columns)
+               && (frame.get_character(r, c, code) != display._shadow[r][c])
+               && frame.is_inRegion(r, c) && !is_overBudget(startTime, budget));
+      const uint16_t address = display.get_address(r, column);
+      if (address == display._cursor) {
+        display._p_driver->write(run, size);
+      } else {
+        display._p_driver->write_at(column, r, run, size);
+        _stats.cursorMoves++;
+        display._cursor = address;
+      }
+      display.advance_cursor(size);
+      _stats.characters += size;
+      progress = true;
+    }
+  }
+  return true;
+}
+
+uint8_t LiquidMenuBase::measure_gap(const LiquidFrame &frame,
+                                    const LiquidDisplay &display,
+                                    const uint8_t code[], uint8_t row,
+                                    uint8_t column, uint8_t columns,
+                                    uint8_t maxGap) const {
+  for (uint8_t gap = 0; (gap <= maxGap) && (column + gap < columns); gap++) {
+    const uint8_t c = column + gap;
+    if (frame.get_character(row, c, code) != display._shadow[row][c]) {
+      // Only a changed character which is sent ends the gap.
+      return frame.is_inRegion(row, c) ? gap : 0;
+    }
+  }
+  return 0;
+}
+
+void LiquidMenuBase::upload_glyph(LiquidDisplay &display, uint8_t index,
+                                  uint8_t glyph[8]) const {
+  display._p_driver->createChar(index, glyph);
+  _stats.glyphUploads++;
+  // The cursor is left in the glyphs' memory.
+  display._cursor = NO_CURSOR;
+}
+
+void LiquidMenuBase::resolve_glyphs(const LiquidFrame &frame, LiquidDisplay &display,
+                                    uint8_t code[]) const {
+  LiquidGlyphSlots &glyphSlots = display._glyphSlots;
+  glyphSlots.next_frame();
+  const uint8_t reserved = frame._reservedGlyphs | _reservedGlyphs;
+  for (uint8_t s = 0; s < GLYPH_SLOTS; s++) {
+    if (reserved & (1 << s)) {
+      glyphSlots.reserve(s);
+    }
+  }
+  // Keeps the glyphs that are already uploaded before replacing any.
+  for (uint8_t g = 0; g < frame._glyphCount; g++) {
+    code[g] = glyphSlots.find(frame._p_glyph[g]);
+    if (code[g] < GLYPH_SLOTS) {
+      glyphSlots.use(code[g]);
+    }
+  }
+  for (uint8_t g = 0; g < frame._glyphCount; g++) {
+    if (code[g] < GLYPH_SLOTS) {
+      continue;
+    }
+    // The same bitmap may have just been uploaded from another array.
+    uint8_t slot = glyphSlots.find(frame._p_glyph[g]);
+    if (slot == GLYPH_SLOTS) {
+      slot = glyphSlots.select();
+      if (slot == GLYPH_SLOTS) {
+        DEBUGLN(F("No free slot for a glyph"));
+        code[g] = ' ';
+        continue;
+      }
+      upload_glyph(display, slot, frame._p_glyph[g]);
+      glyphSlots.assign(slot, frame._p_glyph[g]);
+    }
+    glyphSlots.use(slot);
+    code[g] = slot;
+  }
+}
+
+void LiquidMenuBase::init() const {
+  for (uint8_t d = 0; d <= _mirrorCount; d++) {
+    get_display(d)._glyphSlots.clear();
+    get_display(d)._cursor = NO_CURSOR;
+  }
 }
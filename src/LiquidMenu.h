@@ -43,6 +43,8 @@ Include file for LiquidMenu library.
 #endif
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <Print.h>
 
 #include "LiquidMenu_config.h"
 #include "LiquidMenu_debug.h"
@@ -54,6 +56,12 @@ Include file for LiquidMenu library.
 #elif LIQUIDMENU_LIBRARY == LiquidCrystal_I2C_LIBRARY
 # pragma message ("LiquidMenu: Selected 'LiquidCrystal_I2C' (I2C) library. Edit 'LiquidMenu_config.h' file to change it.")
 #include <LiquidCrystal_I2C.h>
+#elif LIQUIDMENU_LIBRARY == LiquidPCF8574_LIBRARY
+# pragma message ("LiquidMenu: Selected 'LiquidPCF8574' (I2C) library. Edit 'LiquidMenu_config.h' file to change it.")
+#include "LiquidPCF8574.h"
+#elif LIQUIDMENU_LIBRARY == LiquidParallel_LIBRARY
+# pragma message ("LiquidMenu: Selected 'LiquidParallel' (parallel) library. Edit 'LiquidMenu_config.h' file to change it.")
+#include "LiquidParallel.h"
 #else
 # pragma message ("LiquidMenu: Selected custom library. Edit 'LiquidMenu_config.h' file to change it.")
 #endif
@@ -117,6 +125,7 @@ enum class DataType : uint8_t {
   CONST_CHAR_PTR = 62,
   PROG_CONST_CHAR_PTR = 65,
   GLYPH = 70,
+  GLYPH_BITMAP = 71,
   FIRST_GETTER = 200,
   BOOL_GETTER = 201, BOOLEAN_GETTER = 201,
   INT8_T_GETTER = 208,
@@ -141,6 +150,16 @@ enum class Position : uint8_t {
   CUSTOM = 3,
 };
 
+/// Align enum.
+/*
+Used to set how a variable is aligned in a field of a fixed width.
+*/
+enum class Align : uint8_t {
+  LEFT = 0,
+  RIGHT = 1,
+  ZERO = 2, ///< Aligned to the right and padded with zeros
+};
+
 /// @name recognizeType overloaded function
 /**
 Used to recognize the data type of a variable received in a template function.
@@ -220,6 +239,14 @@ DataType recognizeType(float variable);
 */
 DataType recognizeType(double variable);
 
+/**
+@param variable - variable to be checked
+@returns the data type in `DataType` enum format
+
+@note A `uint8_t[8]` array is recognized as a glyph's bitmap.
+*/
+DataType recognizeType(uint8_t* variable);
+
 
 /**
 @param variable - variable to be checked
@@ -315,425 +342,2238 @@ Used for convenience when printing the class's address for identification.
 void print_me(uintptr_t address);
 
 
-/// Represents the individual lines printed on the display.
+/// Marks a `byte` variable as a glyph index in a typed line.
 /**
-This is the lowest class in the hierarchy, it holds pointers to the
-variables/constants that will be printed, where the line is positioned,
-where the focus indicator is positioned and pointers to the callback
-functions. This classes' objects go into a LiquidScreen object which
-controls them. The public methods are for configuration only.
+@see as_glyph(const uint8_t &index)
+@see LiquidTypedLine
 */
-class LiquidLine {
-  friend class LiquidScreen;
-
-public:
-  /// @name Constructors
-  ///@{
+struct LiquidGlyph {
+  const uint8_t *p_index; ///< Pointer to the glyph index
+};
 
-  /// The main constructor.
-  /**
-  This is the main constructor that gets called every time.
+/// Marks a glyph's bitmap in a typed line.
+/**
+@see as_glyph(uint8_t (&bitmap)[8])
+@see LiquidTypedLine
+*/
+struct LiquidGlyphBitmap {
+  uint8_t *p_bitmap; ///< Pointer to the glyph's bitmap
+};
 
-  @param column - the column at which the line starts
-  @param row - the row at which the line is printed
-  */
-  LiquidLine(uint8_t column, uint8_t row)
-    : _row(row), _column(column), _focusRow(row - 1),
-      _focusColumn(column - 1), _focusPosition(Position::NORMAL),
-      _floatDecimalPlaces(2), _variableCount(0), _focusable(false) {
+/// Marks a `const char[]` as stored in flash memory in a typed line.
+/**
+@see as_progmem(const char *text)
+@see LiquidTypedLine
+*/
+struct LiquidProgmem {
+  const char *text; ///< Pointer to the string in flash memory
+};
 
-    for (uint8_t i = 0; i < MAX_VARIABLES; i++) {
-      _variable[i] = nullptr;
-      _variableType[i] = DataType::NOT_USED;
-    }
+/// Prints a byte variable of a typed line as a glyph.
+/**
+This is the typed line's equivalent of `LiquidLine::set_asGlyph()`.
 
-    for (uint8_t f = 0; f < MAX_FUNCTIONS; f++) {
-      _function[f] = 0;
-    }
-  }
+@param &index - variable holding the index of the glyph
+@returns the variable marked as a glyph
+*/
+constexpr LiquidGlyph as_glyph(const uint8_t &index) {
+  return LiquidGlyph{ &index };
+}
 
-  /// Constructor for one variable/constant.
-  /**
-  @param column - the column at which the line starts
-  @param row - the row at which the line is printed
-  @param &variableA - variable/constant to be printed
-  */
-  template <typename A>
-  LiquidLine(uint8_t column, uint8_t row, A &variableA)
-    : LiquidLine(column, row) {
-    add_variable(variableA);
-  }
+/// Temporaries can't be used as glyph indexes, they don't outlive the line.
+LiquidGlyph as_glyph(const uint8_t &&index) = delete;
 
-  /// Constructor for two variables/constants.
-  /**
-  @param column - the column at which the line starts
-  @param row - the row at which the line is printed
-  @param &variableA - variable/constant to be printed
-  @param &variableB - variable/constant to be printed
-  */
-  template <typename A, typename B>
-  LiquidLine(uint8_t column, uint8_t row,
-             A &variableA, B &variableB)
-    : LiquidLine(column, row, variableA) {
-    add_variable(variableB);
-  }
+/// Prints a glyph of a typed line from its bitmap.
+/**
+This is the typed line's equivalent of adding a `uint8_t[8]` to a
+LiquidLine. The glyph is uploaded to the display when it's needed.
 
-  /// Constructor for three variables/constants.
-  /**
-  @param column - the column at which the line starts
-  @param row - the row at which the line is printed
-  @param &variableA - variable/constant to be printed
-  @param &variableB - variable/constant to be printed
-  @param &variableC - variable/constant to be printed
-  */
-  template <typename A, typename B, typename C>
-  LiquidLine(uint8_t column, uint8_t row,
-             A &variableA, B &variableB, C &variableC)
-    : LiquidLine(column, row, variableA, variableB) {
-    add_variable(variableC);
-  }
+@param &bitmap - the glyph's bitmap
+@returns the bitmap marked as a glyph
 
-  /// Constructor for four variables/constants.
-  /**
-  @param column - the column at which the line starts
-  @param row - the row at which the line is printed
-  @param &variableA - variable/constant to be printed
-  @param &variableB - variable/constant to be printed
-  @param &variableC - variable/constant to be printed
-  @param &variableD - variable/constant to be printed
-  */
-  template <typename A, typename B, typename C, typename D>
-  LiquidLine(uint8_t column, uint8_t row,
-             A &variableA, B &variableB, C &variableC, D &variableD)
-    : LiquidLine(column, row, variableA, variableB, variableC) {
-    add_variable(variableD);
-  }
+@see LiquidGlyphSlots
+*/
+constexpr LiquidGlyphBitmap as_glyph(uint8_t (&bitmap)[8]) {
+  return LiquidGlyphBitmap{ bitmap };
+}
 
-  ///@}
+/// Prints a `const char[]` of a typed line from flash memory.
+/**
+This is the typed line's equivalent of `LiquidLine::set_asProgmem()`.
 
+@param *text - string stored in flash memory
+@returns the string marked as stored in flash memory
+*/
+constexpr LiquidProgmem as_progmem(const char *text) {
+  return LiquidProgmem{ text };
+}
 
-  /// @name Public methods
-  ///@{
+/// Marks a variable of a typed line as printed in a field.
+/**
+@see as_field(T &&variable, uint8_t width, Align align)
+@see LiquidTypedLine
+*/
+template <typename T>
+struct LiquidField {
+  T variable; ///< The variable (or a reference to it)
+  uint8_t width; ///< The width of the field, 0 for none
+  Align align; ///< How the value is aligned in the field
+};
 
-  /// Adds a variable to the line.
-  /**
-  @param &variable - reference to the variable
-  @returns true on success and false if the maximum amount of variables
-  has been reached
+/// Prints a variable of a typed line in a field of a fixed width.
+/**
+This is the typed line's equivalent of `LiquidLine::set_fieldWidth()`.
+The variable is held the same way as the line's other variables, by
+reference if it's an lvalue and by value if it's a temporary (e.g.
+`as_glyph()`).
+
+~~~{.cpp}
+auto level_line = make_liquidLine(0, 0, "Level: ",
+                                  as_field(level, 4, Align::RIGHT), "%");
+~~~
+
+@param &&variable - the variable
+@param width - the width of the field, 0 for printing the variable as
+it is
+@param align - `Align::LEFT` (default), `Align::RIGHT` or `Align::ZERO`
+for aligning to the right and padding with zeros
+@returns the variable marked with its field
+*/
+template <typename T>
+constexpr LiquidField<T> as_field(T &&variable, uint8_t width,
+                                  Align align = Align::LEFT) {
+  return LiquidField<T>{ static_cast<T &&>(variable), width, align };
+}
 
-  @note The maximum amount of variable per line is specified in
-  LiquidMenu_config.h as `MAX_VARIABLES`. The default is 5.
 
-  @see LiquidMenu_config.h
-  @see MAX_VARIABLES
+/// Keeps track of the glyphs uploaded to the display.
+/**
+The display holds up to `GLYPH_SLOTS` glyphs in its CGRAM. The glyphs are
+identified by their bitmaps and uploaded only when a printed line needs
+them. A glyph that is already in a slot isn't uploaded again and when all
+of the slots are taken the least recently used one is replaced. Slots used
+by the current frame are never replaced.
+
+Slots used directly by index (`LiquidLine::set_asGlyph()`) and the ones
+reserved with `LiquidMenu::reserve_glyphSlot()` are reserved for the user
+and never replaced.
+
+@note The glyphs are identified by the address of their bitmap. After
+changing a bitmap in place call `LiquidMenu::init()` or use another array.
+*/
+class LiquidGlyphSlots {
+public:
+  /// The main constructor.
+  /**
+  Creates empty slots.
   */
-  template <typename T>
-  bool add_variable(T &variable) {
-    DEBUG(F("LLine ")); print_me(reinterpret_cast<uintptr_t>(this));
-
-    DataType varType = recognizeType(variable);
+  LiquidGlyphSlots();
 
-    #if LIQUIDMENU_DEBUG
-    DEBUG(F("Add "));
-    if ((uint8_t)varType < (uint8_t)DataType::FIRST_GETTER) {
-      DEBUG(F("variable \""));
-      DEBUG(variable);
-    } else {
-      DEBUG(F("getter \"N/A"));
-    }
-    DEBUG(F("\" of DataType("));
-    DEBUG((uint8_t)varType); DEBUG(F(")"));
-    #endif
+  /// Forgets all of the glyphs and reservations.
+  void clear();
 
-    if (_variableCount < MAX_VARIABLES) {
-      _variable[_variableCount] = (void*)&variable;
-      _variableType[_variableCount] = varType;
-      _variableCount++;
-      
-      DEBUGLN(F(""));
-      return true;
-    } else {
-      DEBUGLN(F(" failed, edit LiquidMenu_config.h to allow for more variables"));
-      return false;
-    }
-  }
+  /// Marks the start of a new frame.
+  void next_frame();
 
-  /// Attaches a callback function to the line.
+  /// Finds the slot holding a glyph.
   /**
-  The number is used for identification. The callback function can
-  later be called when the line is focused with
-  `LiquidMenu::call_function(uint8_t number) const`.
-
-  @param number - function number used for identification
-  @param *function - pointer to the function
-  @returns true on success and false if maximum amount of functions
-  has been reached
-
-  @note Function numbering starts from 1.
-  @note The maximum amount of functions per line is specified in
-  LiquidMenu_config.h as `MAX_FUNCTIONS`. The default is 8.
-  @note This is also what makes the line focusable. A line with no
-  attached function (not even a no-op one) is skipped by switch_focus()
-  and rejected by set_focusedLine().
-
-  @see LiquidMenu_config.h
-  @see MAX_FUNCTIONS
-  @see bool LiquidMenu::call_function(uint8_t number) const
+  @param *bitmap - the glyph's bitmap
+  @returns the slot or `GLYPH_SLOTS` if the glyph isn't uploaded
   */
-  bool attach_function(uint8_t number, void (*function)(void));
+  uint8_t find(const uint8_t *bitmap) const;
 
-  /// Sets the decimal places for floating point variables.
+  /// Selects the slot for a new glyph.
   /**
-
-  @param decimalPlaces - number of decimal places to show
+  @returns an empty or the least recently used slot, or `GLYPH_SLOTS`
+  if all of the slots are used by the current frame or reserved
   */
-  void set_decimalPlaces(uint8_t decimalPlaces);
+  uint8_t select() const;
 
-  /// Configures the focus indicator position for the line.
+  /// Records that a glyph was uploaded to a slot.
   /**
-  The valid positions are `LEFT`, `RIGHT` and `CUSTOM`. The `CUSTOM`
-  position is absolute so it also needs the column and row that it
-  will be printed on.
-
-  @param position - `LEFT`, `RIGHT` or `CUSTOM`
-  @param column - if using `CUSTOM` this specifies the column
-  @param row - if using `CUSTOM` this specifies the row
-  @returns true on success and false if the position specified is
-  invalid
-
-  @note The `Position` is enum class. Use `Position::(member)` when
-  specifying the position.
-
-  @see Position
+  @param slot - the slot
+  @param *bitmap - the glyph's bitmap
   */
-  bool set_focusPosition(Position position,
-                         uint8_t column = 0, uint8_t row = 0);
+  void assign(uint8_t slot, const uint8_t *bitmap);
 
-  /// Converts a byte variable into a glyph index.
+  /// Marks a slot as used by the current frame.
   /**
-  If a custom character (glyph) was created using
-  `DisplayClass::createChar(byte index, byte character[8])` it
-  can be displayed as a normal variable using this method.
-
-  @param number - the variable number that will be converted to an index
-  @returns true on success and false if the variable with that number is
-  not a `byte`.
+  @param slot - the slot
   */
-  bool set_asGlyph(uint8_t number);
+  void use(uint8_t slot);
 
-  /// Converts a const char pointer variable into const char pointer PROGMEM one.
+  /// Forgets a glyph so that it's uploaded again when needed.
   /**
-  Use this function to tell the object that the attached const char pointer
-  variable is saved in flash memory rather than in RAM like a normal variable.
+  @param *bitmap - the glyph's bitmap
+  */
+  void forget(const uint8_t *bitmap);
 
-  @param number - the variable number that will be converted
-  @returns true on success and false if the variable with that number is
-  not a `const char[]`.
+  /// Reserves a slot for glyphs uploaded by the user.
+  /**
+  @param slot - the slot
   */
-  bool set_asProgmem(uint8_t number);
-  ///@}
+  void reserve(uint8_t slot);
 
 private:
-  /// Prints the line to the display.
+  const uint8_t *_p_bitmap[GLYPH_SLOTS]; ///< The glyph in every slot
+  uint8_t _order[GLYPH_SLOTS]; ///< The slots, most recently used first
+  uint8_t _usedInFrame; ///< Bit mask of the slots used by the current frame
+  uint8_t _reserved; ///< Bit mask of the slots reserved for the user
+};
+
+
+/// A set of indexes kept as bits.
+/**
+Used for the hidden screens and the focusable lines so that the next or
+previous one is found without visiting every screen or line. The bits are
+stored in an array owned by the user of the mask, one bit per index. The
+search skips eight indexes per step and finds the set bit in a byte with a
+bit scan, so a mask of `MAX_SCREENS` or `MAX_LINES` is searched in one or
+two steps.
+*/
+class LiquidIndexMask {
+public:
+  /// The main constructor.
   /**
-  Sets the cursor to the starting position. Then goes through a loop
-  calling `print_variable(DisplayClass *p_liquidCrystal, uint8_t number)`.
-  And finally displays the focus indicator if the line is focused.
+  Clears the bits.
 
-  @param *p_liquidCrystal - pointer to the DisplayClass object
-  @param isFocused - true if this line is focused
+  @param *p_bits - array for the bits, `(capacity + 7) / 8` bytes long
+  @param capacity - the count of the indexes
   */
-  void print(DisplayClass *p_liquidCrystal, bool isFocused);
+  LiquidIndexMask(uint8_t *p_bits, uint8_t capacity);
 
-  /// Prints a variable to the display.
+  /// Copies the bits of another mask, as many as fit.
   /**
-  Casts the variable pointer specified by the number to its data type
-  and prints it to the display.
-
-  @param *p_liquidCrystal - pointer to the DisplayClass object
-  @param number - number identifying the variable
+  @param &other - the copied mask
   */
-  void print_variable(DisplayClass *p_liquidCrystal, uint8_t number);
+  void copy(const LiquidIndexMask &other);
 
-  /// Check if there is an attached function at the specified number.
+  /// Sets or clears the bit of an index.
   /**
-  @param number - number of the function in the array
-  @returns true if there is a function at the specified number
+  Indexes outside of the mask are ignored.
 
-  @note Function numbering starts from 1.
+  @param index - the index
+  @param value - true to set the bit, false to clear it
+  */
+  void set(uint8_t index, bool value);
 
-  @see bool LiquidLine::attach_function(uint8_t number, void (*function)(void))
+  /// Checks the bit of an index.
+  /**
+  @param index - the index
+  @returns true if the bit is set
   */
-  bool is_callable(uint8_t number) const;
+  bool is_set(uint8_t index) const;
 
-  /// Calls an attached function specified by the number.
+  /// Returns the count of the indexes.
   /**
-  @param number - number identifying the function
-  @returns true if there is a function at the specified number
+  @returns the count of the indexes
+  */
+  uint8_t get_capacity() const;
 
-  @note Function numbering starts from 1.
+  /// Finds the first set index in a range.
+  /**
+  @param from - the first index of the range
+  @param end - the index after the last one of the range
+  @returns the first set index which is at least `from` and less than
+  `end`, or `end` if there is none
+  */
+  uint8_t find_next(uint8_t from, uint8_t end) const;
 
-  @see bool LiquidLine::attach_function(uint8_t number, void (*function)(void))
+  /// Finds the last set index before another.
+  /**
+  @param end - the index after the last one of the range
+  @returns the last set index which is less than `end`, or `end` if there
+  is none
   */
-  bool call_function(uint8_t number) const;
+  uint8_t find_previous(uint8_t end) const;
 
-  uint8_t _row, _column, _focusRow, _focusColumn;
-  Position _focusPosition;
-  uint8_t _floatDecimalPlaces;
-  uint8_t _variableCount; ///< Count of the variables
-  void (*_function[MAX_FUNCTIONS])(void); ///< Pointers to the functions
-  const void *_variable[MAX_VARIABLES]; ///< Pointers to the variables
-  DataType _variableType[MAX_VARIABLES]; ///< Data type of the variables
-  bool _focusable; ///< Determines whether the line is focusable
+private:
+  uint8_t *_p_bits; ///< The bits, the lowest bit of the first byte is index 0
+  uint8_t _capacity; ///< The count of the indexes
 };
 
 
-/// Represents a screen shown on the display.
-/**
-A screen is made up of LiquidLine objects. It holds pointers to them and
-calls their functions when it is active. It also knows on which line the
-focus is. This classes' objects go into a LiquidMenu object which controls
-them. The public methods are for configuration only.
+class LiquidMenuBase;
 
-@see LiquidLine
+/// Represents a frame of the display's characters.
+/**
+The lines are printed into a frame instead of directly to the display. The
+frame holds a copy of every character of the display which is later compared
+to what the display currently shows, so that only the changed characters are
+sent to it. Characters printed outside of `MAX_COLUMNS` and `MAX_ROWS` are
+discarded.
+
+@see LiquidMenu_config.h
+@see MAX_COLUMNS
+@see MAX_ROWS
 */
-class LiquidScreen {
-  friend class LiquidMenu;
+class LiquidFrame : public Print {
+  friend class LiquidMenuBase;
 
 public:
-
-  /// @name Constructors
-  ///@{
-
   /// The main constructor.
   /**
-  This is the main constructor that gets called every time.
+  Creates a blank frame.
   */
-  LiquidScreen();
+  LiquidFrame();
 
-  /// Constructor for 1 LiquidLine object.
-  /**
-  @param &liquidLine - pointer to a LiquidLine object
-  */
-  explicit LiquidScreen(LiquidLine &liquidLine);
+  /// Fills the frame with blank characters.
+  void clear();
 
-  /// Constructor for 2 LiquidLine object.
+  /// Positions the cursor of the frame.
   /**
-  @param &liquidLine1 - pointer to a LiquidLine object
-  @param &liquidLine2 - pointer to a LiquidLine object
+  @param column - the column of the next printed character
+  @param row - the row of the next printed character
   */
-  LiquidScreen(LiquidLine &liquidLine1, LiquidLine &liquidLine2);
+  void setCursor(uint8_t column, uint8_t row);
 
-  /// Constructor for 3 LiquidLine object.
+  /// Writes a character at the cursor and advances it.
   /**
-  @param &liquidLine1 - pointer to a LiquidLine object
-  @param &liquidLine2 - pointer to a LiquidLine object
-  @param &liquidLine3 - pointer to a LiquidLine object
+  @param character - the character to be written
+  @returns always 1, characters outside of the frame are discarded
   */
-  LiquidScreen(LiquidLine &liquidLine1, LiquidLine &liquidLine2,
-               LiquidLine &liquidLine3);
+  virtual size_t write(uint8_t character);
 
-  /// Constructor for 4 LiquidLine object.
+  /// Writes a number of characters at the cursor and advances it.
   /**
-  @param &liquidLine1 - pointer to a LiquidLine object
-  @param &liquidLine2 - pointer to a LiquidLine object
-  @param &liquidLine3 - pointer to a LiquidLine object
-  @param &liquidLine4 - pointer to a LiquidLine object
+  @param *buffer - the characters to be written
+  @param size - the number of characters
+  @returns always `size`, characters outside of the frame are discarded
   */
-  LiquidScreen(LiquidLine &liquidLine1, LiquidLine &liquidLine2,
-               LiquidLine &liquidLine3, LiquidLine &liquidLine4);
+  virtual size_t write(const uint8_t *buffer, size_t size);
 
-  ///@}
+  using Print::write;
 
-  /// @name Public methods
+  /// @name Number formatting
+  /**
+  Faster alternatives to `Print::print()` for numbers. The digits are
+  formatted into a small buffer two at a time and written at once.
+  */
   ///@{
 
-  /// Adds a LiquidLine object to the screen.
+  /// Prints an unsigned integer.
   /**
-  @param &liquidLine - pointer to a LiquidLine object
-  @returns true on success and false if the maximum amount of lines
-  has been reached
-
-  @note The maximum amount of lines per screen is specified in
-  LiquidMenu_config.h as `MAX_LINES`. The default is 8.
+  @param value - the number to be printed
+  */
+  void print_unsigned(uint32_t value);
 
-  @see LiquidMenu_config.h
-  @see MAX_LINES
+  /// Prints a signed integer.
+  /**
+  @param value - the number to be printed
   */
-  bool add_line(LiquidLine &liquidLine);
+  void print_signed(int32_t value);
 
-  /// Sets the focus position for the whole screen at once.
+  /// Prints a floating point number.
   /**
-  The valid positions are `LEFT` and `RIGHT`. `CUSTOM` is not valid
-  for this function because it needs individual column and row for
-  every line.
+  The fraction is converted to an integer once instead of digit by digit.
+  Values that don't fit in 32 bits and more than 9 decimal places are
+  printed by `Print::print()`.
 
-  @param position - `LEFT` or `RIGHT`
-  @returns true on success and false if the position specified is
-  invalid
+  @param value - the number to be printed
+  @param decimalPlaces - the number of decimal places
+  */
+  void print_float(double value, uint8_t decimalPlaces);
+  ///@}
 
-  @note The `Position` is enum class. Use `Position::(member)` when
-  specifying the position.
+  /// Prints a string stored in flash memory.
+  /**
+  The string is read from flash in small chunks, without copying all of
+  it to RAM first.
 
-  @see Position
+  @param *text - pointer to the string in flash memory
   */
-  bool set_focusPosition(Position position);
+  void print_progmem(const char *text);
 
-  /// Specifies the line size of the display (required for scrolling).
+  /// @name Glyphs
+  ///@{
+
+  /// Prints a glyph from its bitmap.
   /**
-  This is required when you want to add more lines (LiquidLine
-  objects) to a screen (LiquidScreen object) than the display's line
-  size. The lines will be scrolled.
+  The glyph is uploaded to the display by the menu after the whole frame
+  is printed, so that the glyphs already on the display are kept.
 
-  @param lineCount - the line size of the display
+  @param *bitmap - the glyph's bitmap
 
-  @warning Set this after adding all the "lines" to the "screen"!
-  @warning Scrolling currently only works with "focusable" lines!
+  @note Up to `GLYPH_SLOTS` different glyphs can be printed in a frame,
+  the rest are printed as spaces.
   */
-  void set_displayLineCount(uint8_t lineCount);
+  void write_glyph(uint8_t *bitmap);
 
-  /// Hides the screen.
+  /// Prints a glyph uploaded by the user.
   /**
-  Hiding a screen means that it will be skipped when cycling the
-  screens.
+  The glyph's slot is reserved and never used for other glyphs.
 
-  @param hide - true for hiding and false for unhiding
-
-  @note It can still be shown using the `change_screen` methods.
+  @param index - the glyph's index
+  */
+  void write_glyphIndex(uint8_t index);
+
+  /// Prints the menu's focus indicator.
+  /**
+  @param position - the focus position whose symbol is printed
+  */
+  void write_focusGlyph(Position position);
+  ///@}
+
+  /// @name Regions
+  /**
+  Called by the lines while they are printed. When the menu refreshes
+  some of the lines or a single variable the cells written by them are
+  marked, only they are sent to the display.
+  */
+  ///@{
+
+  /// Starts printing a line.
+  /**
+  @param isTarget - true if the line is refreshed
+  */
+  void begin_line(bool isTarget);
+
+  /// Starts printing the next variable of the line.
+  void begin_variable();
+
+  /// Ends printing the line.
+  void end_line();
+  ///@}
+
+  /// @name Fields
+  /**
+  A variable printed in a field always takes the field's width. Shorter
+  values are padded and longer ones are clipped, so a value overwrites
+  the previous one in place.
+  */
+  ///@{
+
+  /// Starts a field at the cursor.
+  /**
+  @param width - the width of the field
+  @param align - how the value is aligned in the field
+  */
+  void begin_field(uint8_t width, Align align);
+
+  /// Pads the value printed since `begin_field()` to the field's width.
+  void end_field();
+  ///@}
+
+  /// @name Typed printing
+  /**
+  Prints a variable of a LiquidTypedLine. The overload is selected at
+  compile time by the type of the variable.
+
+  @param &value - the value to be printed
+  @param decimalPlaces - decimal places for floating point values
+  */
+  ///@{
+  template <typename T>
+  void print_value(T value, uint8_t decimalPlaces) {
+    print(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(signed char value, uint8_t decimalPlaces) {
+    print_signed(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(unsigned char value, uint8_t decimalPlaces) {
+    print_unsigned(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(short value, uint8_t decimalPlaces) {
+    print_signed(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(unsigned short value, uint8_t decimalPlaces) {
+    print_unsigned(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(int value, uint8_t decimalPlaces) {
+    print_signed(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(unsigned int value, uint8_t decimalPlaces) {
+    print_unsigned(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(long value, uint8_t decimalPlaces) {
+    print_signed(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(unsigned long value, uint8_t decimalPlaces) {
+    print_unsigned(value);
+    (void)decimalPlaces;
+  }
+
+  void print_value(float value, uint8_t decimalPlaces) {
+    print_float(value, decimalPlaces);
+  }
+
+  void print_value(double value, uint8_t decimalPlaces) {
+    print_float(value, decimalPlaces);
+  }
+
+  template <typename R>
+  void print_value(R (*getter)(), uint8_t decimalPlaces) {
+    if (getter != nullptr) {
+      print_value(getter(), decimalPlaces);
+    }
+  }
+
+  void print_value(const LiquidGlyph &glyph, uint8_t decimalPlaces) {
+    write_glyphIndex(*glyph.p_index);
+    (void)decimalPlaces;
+  }
+
+  void print_value(const LiquidGlyphBitmap &glyph, uint8_t decimalPlaces) {
+    write_glyph(glyph.p_bitmap);
+    (void)decimalPlaces;
+  }
+
+  void print_value(const LiquidProgmem &progmem, uint8_t decimalPlaces);
+
+  template <typename T>
+  void print_value(const LiquidField<T> &field, uint8_t decimalPlaces) {
+    if (field.width > 0) {
+      begin_field(field.width, field.align);
+      print_value(field.variable, decimalPlaces);
+      end_field();
+    } else {
+      print_value(field.variable, decimalPlaces);
+    }
+  }
+  ///@}
+
+private:
+  uint8_t _cell[MAX_ROWS][MAX_COLUMNS]; ///< The characters of the frame
+  uint8_t _column, _row; ///< Position of the cursor
+  uint8_t _columnLimit; ///< Characters from this column on are discarded
+  uint8_t _fieldStart; ///< The first column of the current field
+  Align _fieldAlign; ///< The alignment of the current field
+  const LiquidMenuBase *_p_menu; ///< The menu printing the frame
+  uint8_t *_p_glyph[GLYPH_SLOTS]; ///< The glyphs printed in the frame
+  uint8_t _glyphCount; ///< Count of the glyphs printed in the frame
+  /// Bit mask of the cells holding a glyph from `_p_glyph`
+  uint8_t _glyphCell[MAX_ROWS][(MAX_COLUMNS + 7) / 8];
+  uint8_t _reservedGlyphs; ///< Bit mask of the glyphs printed by index
+
+  /// Marks a cell of the cursor's row as written.
+  /**
+  @param column - the column of the cell
+  */
+  void mark_cell(uint8_t column);
+
+  /// Returns the character of a cell as it's sent to a display.
+  /**
+  @param row - the row of the cell
+  @param column - the column of the cell
+  @param code[] - the display's character codes of the frame's glyphs
+  @returns the character
+  */
+  uint8_t get_character(uint8_t row, uint8_t column, const uint8_t code[]) const;
+
+  /// Puts a character in a cell of the cursor's row.
+  /**
+  @param column - the column of the cell
+  @param character - the character
+  @param isGlyph - true if the character is a glyph's index
+  */
+  void put_cell(uint8_t column, uint8_t character, bool isGlyph);
+
+  /// Extends the marked cells over the blank cells following them.
+  /**
+  These blank cells were written by the refreshed line if it got shorter.
+
+  @returns true if any cell is marked
+  */
+  bool close_region();
+
+  /// Checks if a cell is sent to the display.
+  /**
+  @param row - the row of the cell
+  @param column - the column of the cell
+  @returns true if no region is marked or the cell is in it
+  */
+  bool is_inRegion(uint8_t row, uint8_t column) const;
+
+  bool _targeted; ///< Only the refreshed lines are sent
+  bool _lineTargeted; ///< The line being printed is refreshed
+  uint8_t _targetVariable; ///< The refreshed variable, 0 for whole lines
+  uint8_t _variable; ///< Number of the variable being printed
+  bool _marking; ///< True while the refreshed region is printed
+  /// Bit mask of the cells written by any line
+  uint8_t _writtenCell[MAX_ROWS][(MAX_COLUMNS + 7) / 8];
+  /// Bit mask of the cells in the refreshed region
+  uint8_t _markedCell[MAX_ROWS][(MAX_COLUMNS + 7) / 8];
+};
+
+
+/// The base of the lines printed on the display.
+/**
+Holds everything that is common for the lines - where the line is
+positioned, where the focus indicator is positioned and pointers to the
+callback functions. The variables are held by the derived classes:
+LiquidLine keeps them as `void*` with a `DataType` and LiquidTypedLine
+keeps them with their own types. The objects of these classes go into a
+LiquidScreen object which controls them. The public methods are for
+configuration only.
+
+@see LiquidLine
+@see LiquidTypedLine
+*/
+class LiquidLineBase {
+  friend class LiquidScreenBase;
+  friend class LiquidMenuBase;
+
+public:
+  /// @name Public methods
+  ///@{
+
+  /// Attaches a callback function to the line.
+  /**
+  The number is used for identification. The callback function can
+  later be called when the line is focused with
+  `LiquidMenu::call_function(uint8_t number) const`.
+
+  @param number - function number used for identification
+  @param *function - pointer to the function
+  @returns true on success and false if maximum amount of functions
+  has been reached
+
+  @note Function numbering starts from 1.
+  @note The maximum function number is specified in
+  LiquidMenu_config.h as `MAX_FUNCTIONS`. The default is 8. Only the
+  attached functions take memory, they are kept in the line slots shared
+  by all lines (`MAX_LINE_SLOTS`).
+  @note This is also what makes the line focusable. A line with no
+  attached function (not even a no-op one) is skipped by switch_focus()
+  and rejected by set_focusedLine().
+
+  @see LiquidMenu_config.h
+  @see MAX_FUNCTIONS
+  @see MAX_LINE_SLOTS
+  @see bool LiquidMenu::call_function(uint8_t number) const
+  */
+  bool attach_function(uint8_t number, void (*function)(void));
+
+  /// Sets the decimal places for floating point variables.
+  /**
+
+  @param decimalPlaces - number of decimal places to show
+  */
+  void set_decimalPlaces(uint8_t decimalPlaces);
+
+  /// Configures the focus indicator position for the line.
+  /**
+  The valid positions are `LEFT`, `RIGHT` and `CUSTOM`. The `CUSTOM`
+  position is absolute so it also needs the column and row that it
+  will be printed on.
+
+  @param position - `LEFT`, `RIGHT` or `CUSTOM`
+  @param column - if using `CUSTOM` this specifies the column
+  @param row - if using `CUSTOM` this specifies the row
+  @returns true on success and false if the position specified is
+  invalid
+
+  @note The `Position` is enum class. Use `Position::(member)` when
+  specifying the position.
+
+  @see Position
+  */
+  bool set_focusPosition(Position position,
+                         uint8_t column = 0, uint8_t row = 0);
+
+  /// Sets how often the line is redrawn by `LiquidMenu::tick()`.
+  /**
+  The line is due whenever the time passed to `tick()` crosses a multiple
+  of the period, so the lines with the same period are redrawn together.
+  The period is kept in one of the line slots, with the attached
+  functions.
+
+  @param period - the refresh period in milliseconds, 0 for never
+  (default)
+  @returns true on success and false if no line slot was left
+
+  @note The line is redrawn only while it's visible, a period shorter
+  than the time between the calls to `tick()` is rounded up to the next
+  call.
+
+  @see LiquidMenu::tick(uint32_t now)
+  */
+  bool set_refreshPeriod(uint16_t period);
+
+  /// Returns the count of the unused line slots.
+  /**
+  The variables of LiquidLine objects and the attached functions of all
+  lines are kept in `MAX_LINE_SLOTS` slots shared by all lines. The slots
+  of a line are released when it's destroyed.
+
+  @returns the count of the unused line slots
+
+  @see MAX_LINE_SLOTS
+  */
+  static uint8_t get_freeSlots();
+
+  /// Returns the count of the line slots that were missing.
+  /**
+  A variable or a function added when all of the slots are used isn't
+  added. Most lines are constructed before `Serial` is started, so check
+  this in `setup()` and raise `MAX_LINE_SLOTS` by the returned count.
+
+  @returns the count of the variables and functions which weren't added,
+  0 if all of them were
+
+  @see MAX_LINE_SLOTS
+  */
+  static uint8_t get_missingSlots();
+  ///@}
+
+  /// The lines can't be copied, their slots would be shared.
+  LiquidLineBase(const LiquidLineBase &) = delete;
+  LiquidLineBase& operator=(const LiquidLineBase &) = delete;
+
+protected:
+  /// The main constructor.
+  /**
+  @param column - the column at which the line starts
+  @param row - the row at which the line is printed
+  */
+  LiquidLineBase(uint8_t column, uint8_t row);
+
+  /// Takes over the attached functions of another line.
+  /**
+  Lets `make_liquidLine()` return a line, the other line is left without
+  functions.
+
+  @param &&other - the line that is moved
+  */
+  LiquidLineBase(LiquidLineBase &&other);
+
+  /// Releases the slots of the attached functions.
+  /**
+  Not virtual, the lines aren't destroyed through this class.
+  */
+  ~LiquidLineBase();
+
+  /// Takes a line slot and appends it to a list of slots.
+  /**
+  @param &list - the handle of the list's first slot
+  @param *p_item - the variable or the function
+  @param tag - the variable's `DataType` or the function's number
+  @returns true on success and false if there are no more slots
+  */
+  static bool append_slot(uint8_t &list, const void *p_item, uint8_t tag);
+
+  /// Releases a list of slots.
+  /**
+  @param &list - the handle of the list's first slot, set to `NO_SLOT`
+  */
+  static void release_slots(uint8_t &list);
+
+  /// Moves the line.
+  /**
+  @param column - the column at which the line starts
+  @param row - the row at which the line is printed
+  */
+  void set_position(uint8_t column, uint8_t row);
+
+  /// Prints a variable to the frame.
+  /**
+  Casts the variable pointer to its data type and prints it to the frame.
+
+  @param *p_frame - pointer to the LiquidFrame object
+  @param *p_variable - pointer to the variable
+  @param varType - the data type of the variable
+  @param decimalPlaces - decimal places of floating point numbers
+  */
+  static void print_variable(LiquidFrame *p_frame, const void *p_variable,
+                             DataType varType, uint8_t decimalPlaces);
+
+  /// Checks whether a getter returned a new value.
+  /**
+  A getter without a cache can't be compared, it isn't called and counts
+  as changed, so that it's called only once when the line is printed.
+
+  @param *p_getter - the getter function
+  @param getterType - the getter's `DataType`
+  @returns true if the getter returned a new value or isn't cached
+  */
+  static bool query_getter(const void *p_getter, DataType getterType);
+
+  uint8_t _column : 6; ///< The column at which the line starts
+  uint8_t _focusPosition : 2; ///< The `Position` of the focus indicator
+  uint8_t _focusColumn : 6; ///< The column of a `CUSTOM` focus indicator
+  bool _focusable : 1; ///< Determines whether the line is focusable
+  uint8_t _row : 3; ///< The row at which the line is printed
+  uint8_t _focusRow : 3; ///< The row of a `CUSTOM` focus indicator
+  bool _refreshDue : 1; ///< The line is redrawn by the next refresh
+  uint8_t _floatDecimalPlaces; ///< Decimal places of floating point numbers
+  /// Handle of the first slot of the attached functions and the refresh
+  /// period
+  uint8_t _functions;
+
+  /// Counts the lines which became focusable, the screens rebuild their
+  /// masks of focusable lines when it changes.
+  static uint16_t _focusableChanges;
+
+private:
+  /// Checks if a multiple of the line's refresh period has passed.
+  /**
+  Marks the line for the next refresh when it's due.
+
+  @param now - the current time in milliseconds
+  @param elapsed - milliseconds since the previous check
+  @param &wait - milliseconds until the next redraw, lowered to the time
+  until this line is due
+  @returns true if the line is due
+  */
+  bool schedule_refresh(uint32_t now, uint32_t elapsed, uint16_t &wait);
+
+  /// Prints the line to the frame.
+  /**
+  Sets the cursor to the starting position. Then prints the variables
+  with `print_variables(LiquidFrame *p_frame)`. And finally displays the
+  focus indicator if the line is focused.
+
+  @param *p_frame - pointer to the LiquidFrame object
+  @param isFocused - true if this line is focused
+  */
+  void print(LiquidFrame *p_frame, bool isFocused);
+
+  /// Prints the variables of the line to the frame.
+  /**
+  @param *p_frame - pointer to the LiquidFrame object
+  */
+  virtual void print_variables(LiquidFrame *p_frame) = 0;
+
+  /// Check if there is an attached function at the specified number.
+  /**
+  @param number - number of the function in the array
+  @returns true if there is a function at the specified number
+
+  @note Function numbering starts from 1.
+
+  @see bool LiquidLineBase::attach_function(uint8_t number, void (*function)(void))
+  */
+  virtual bool is_callable(uint8_t number) const;
+
+  /// Calls an attached function specified by the number.
+  /**
+  @param number - number identifying the function
+  @returns true if there is a function at the specified number
+
+  @note Function numbering starts from 1.
+
+  @see bool LiquidLineBase::attach_function(uint8_t number, void (*function)(void))
+  */
+  virtual bool call_function(uint8_t number) const;
+
+  /// Calls the line's getters whose re-query interval has elapsed.
+  /**
+  @returns true if any of the getters returned a new value
+  */
+  virtual bool query_getters();
+
+  /// Stops/resumes calling the getters that were already called.
+  /**
+  Used while printing the values that were just queried.
+
+  @param hold - true for printing the last values of the getters
+  */
+  static void hold_getters(bool hold);
+};
+
+
+/// Represents the individual lines printed on the display.
+/**
+This is the lowest class in the hierarchy, it holds pointers to the
+variables/constants that will be printed. Their data types are recognized
+when they are added and are used for casting the pointers back when
+printing.
+
+@see LiquidLineBase
+@see LiquidTypedLine
+*/
+class LiquidLine : public LiquidLineBase {
+public:
+  /// @name Constructors
+  ///@{
+
+  /// The main constructor.
+  /**
+  This is the main constructor that gets called every time.
+
+  @param column - the column at which the line starts
+  @param row - the row at which the line is printed
+  */
+  LiquidLine(uint8_t column, uint8_t row)
+    : LiquidLineBase(column, row), _variables(NO_SLOT) {}
+
+  /// Takes over the variables and the functions of another line.
+  /**
+  @param &&other - the line that is moved, it's left empty
+  */
+  LiquidLine(LiquidLine &&other)
+    : LiquidLineBase(static_cast<LiquidLineBase &&>(other)),
+      _variables(other._variables) {
+    other._variables = NO_SLOT;
+  }
+
+  /// Releases the slots of the variables.
+  ~LiquidLine() {
+    release_slots(_variables);
+  }
+
+  /// Constructor for one or more variables/constants.
+  /**
+  @param column - the column at which the line starts
+  @param row - the row at which the line is printed
+  @param &variable - variable/constant to be printed
+  @param &variables - more variables/constants to be printed
+
+  @note The maximum amount of variable per line is specified in
+  LiquidMenu_config.h as `MAX_VARIABLES`. The default is 5.
+  */
+  template <typename T, typename... Ts>
+  LiquidLine(uint8_t column, uint8_t row, T &variable, Ts &... variables)
+    : LiquidLine(column, row) {
+    add_variables(variable, variables...);
+  }
+
+  ///@}
+
+
+  /// @name Public methods
+  ///@{
+
+  /// Adds a variable to the line.
+  /**
+  @param &variable - reference to the variable
+  @returns true on success and false if the maximum amount of variables
+  has been reached
+
+  @note The maximum amount of variable per line is specified in
+  LiquidMenu_config.h as `MAX_VARIABLES`. The default is 5. The
+  variables are kept in the line slots shared by all lines
+  (`MAX_LINE_SLOTS`).
+
+  @see LiquidMenu_config.h
+  @see MAX_VARIABLES
+  @see MAX_LINE_SLOTS
+  */
+  template <typename T>
+  bool add_variable(T &variable) {
+    DEBUG(F("LLine ")); print_me(reinterpret_cast<uintptr_t>(this));
+
+    DataType varType = recognizeType(variable);
+
+    #if LIQUIDMENU_DEBUG
+    DEBUG(F("Add "));
+    if ((uint8_t)varType < (uint8_t)DataType::FIRST_GETTER) {
+      DEBUG(F("variable \""));
+      DEBUG(variable);
+    } else {
+      DEBUG(F("getter \"N/A"));
+    }
+    DEBUG(F("\" of DataType("));
+    DEBUG((uint8_t)varType); DEBUG(F(")"));
+    #endif
+
+    return add_variable((const void*)&variable, varType);
+  }
+
+  /// Converts a byte variable into a glyph index.
+  /**
+  If a custom character (glyph) was created using
+  `DisplayClass::createChar(byte index, byte character[8])` it
+  can be displayed as a normal variable using this method.
+
+  @param number - the variable number that will be converted to an index
+  @returns true on success and false if the variable with that number is
+  not a `byte`.
+
+  @note The glyph's slot is reserved for the user once the line is
+  printed, until then the menu may upload its own glyphs to it. Reserve
+  it from the start with `LiquidMenu::reserve_glyphSlot()`. A glyph's
+  `byte[8]` bitmap can be added to the line instead, then the menu
+  uploads it when it's needed.
+
+  @see LiquidGlyphSlots
+  */
+  bool set_asGlyph(uint8_t number);
+
+  /// Converts a const char pointer variable into const char pointer PROGMEM one.
+  /**
+  Use this function to tell the object that the attached const char pointer
+  variable is saved in flash memory rather than in RAM like a normal variable.
+
+  @param number - the variable number that will be converted
+  @returns true on success and false if the variable with that number is
+  not a `const char[]`.
+  */
+  bool set_asProgmem(uint8_t number);
+
+  /// Sets the minimum time between the calls to the line's getters.
+  /**
+  The value returned by every getter is kept and printed again until the
+  interval elapses, which avoids reading slow sensors on every update.
+  Without an interval the getters are called on every update.
+
+  @param interval - the minimum interval in milliseconds, 0 for calling
+  the getters on every update
+  @returns true on success and false if a getter didn't get a cache
+  when it was added
+
+  @note The value and the interval belong to the getter, they are shared
+  by all of the lines printing it. Up to `MAX_GETTER_CACHES` getters are
+  kept.
+
+  @see MAX_GETTER_CACHES
+  @see LiquidMenu::refresh_getters()
+  */
+  bool set_getterInterval(uint16_t interval);
+
+  /// Returns the count of the getters that didn't fit in the caches.
+  /**
+  @returns the count of the getters added to the lines when all of the
+  caches were taken, raise `MAX_GETTER_CACHES` by it
+
+  @see MAX_GETTER_CACHES
+  */
+  static uint8_t get_missingGetterCaches();
+
+  /// Prints a variable in a field of a fixed width.
+  /**
+  The variable always takes the same columns, shorter values are padded
+  and longer ones are clipped. The variables after it don't move when
+  its value changes and it overwrites the previous value in place,
+  without clearing the display.
+
+  @param number - the variable number, starting from 1
+  @param width - the width of the field, 0 for printing the variable
+  as it is (default)
+  @param align - `Align::LEFT` (default), `Align::RIGHT` or `Align::ZERO`
+  for aligning to the right and padding with zeros
+  @returns true on success and false if there is no variable with that
+  number
+
+  @note The `Align` is enum class. Use `Align::(member)` when specifying
+  the alignment.
+
+  @see Align
+  */
+  bool set_fieldWidth(uint8_t number, uint8_t width, Align align = Align::LEFT);
+  ///@}
+
+private:
+  /// Adds the variables passed to the constructor one by one.
+  template <typename T, typename... Ts>
+  void add_variables(T &variable, Ts &... variables) {
+    add_variable(variable);
+    add_variables(variables...);
+  }
+
+  /// Ends the recursion of `add_variables`.
+  void add_variables() {}
+
+  /// Adds a variable with a recognized data type to the line.
+  /**
+  @param *p_variable - pointer to the variable
+  @param varType - the data type of the variable
+  @returns true on success and false if the maximum amount of variables
+  has been reached or there are no more line slots
+  */
+  bool add_variable(const void *p_variable, DataType varType);
+
+  /// Finds the slot of a variable.
+  /**
+  @param number - number identifying the variable, starting from 1
+  @returns the slot's handle or `NO_SLOT`
+  */
+  uint8_t find_variable(uint8_t number) const;
+
+  /// Calls the line's getters whose re-query interval has elapsed.
+  /**
+  @returns true if any of the getters returned a new value
+  */
+  virtual bool query_getters();
+
+  /// Prints the variables of the line to the frame.
+  /**
+  Goes through a loop calling
+  `print_variable()` for every variable.
+
+  @param *p_frame - pointer to the LiquidFrame object
+  */
+  virtual void print_variables(LiquidFrame *p_frame);
+
+  uint8_t _variables; ///< Handle of the first variable's slot
+};
+
+
+/// Holds the variables of a typed line.
+/**
+Every variable is kept with its own type. Variables passed as lvalues are
+held by reference and temporaries (e.g. `as_glyph()`) are held by value.
+
+@see LiquidTypedLine
+*/
+template <typename... Ts>
+struct LiquidVariables;
+
+/// Holds no variables, ends the recursion.
+template <>
+struct LiquidVariables<> {
+  void print(LiquidFrame *, uint8_t) const {}
+};
+
+/// Holds the first variable and the rest of them.
+template <typename T, typename... Ts>
+struct LiquidVariables<T, Ts...> : LiquidVariables<Ts...> {
+  LiquidVariables(T &&variable, Ts &&... variables)
+    : LiquidVariables<Ts...>(static_cast<Ts &&>(variables)...),
+      _variable(static_cast<T &&>(variable)) {}
+
+  /// Prints the variables in order.
+  void print(LiquidFrame *p_frame, uint8_t decimalPlaces) const {
+    p_frame->begin_variable();
+    p_frame->print_value(_variable, decimalPlaces);
+    LiquidVariables<Ts...>::print(p_frame, decimalPlaces);
+  }
+
+  T _variable; ///< The variable (or a reference to it)
+};
+
+
+/// Represents a line whose variables keep their own types.
+/**
+Unlike LiquidLine, the variables are not stored as `void*` with a
+`DataType` that is switched on when printing. Each variable is printed
+with a direct call resolved for its type at compile time and the line
+holds only as many variables as it was created with. Create the lines
+with `make_liquidLine()`:
+
+~~~{.cpp}
+auto temperature_line = make_liquidLine(0, 0, "Temp: ", temperature, "C");
+~~~
+
+The supported types are the same as for LiquidLine. Getter functions are
+called when printing, glyphs and strings in flash memory are passed
+through `as_glyph()` and `as_progmem()` and the variables printed in
+fields of a fixed width through `as_field()`.
+
+@see make_liquidLine
+@see LiquidLine
+*/
+template <typename... Ts>
+class LiquidTypedLine : public LiquidLineBase {
+public:
+  /// The main constructor.
+  /**
+  @param column - the column at which the line starts
+  @param row - the row at which the line is printed
+  @param &&variables - variables/constants to be printed
+  */
+  LiquidTypedLine(uint8_t column, uint8_t row, Ts &&... variables)
+    : LiquidLineBase(column, row),
+      _variables(static_cast<Ts &&>(variables)...) {}
+
+private:
+  /// Prints the variables of the line to the frame.
+  /**
+  @param *p_frame - pointer to the LiquidFrame object
+  */
+  virtual void print_variables(LiquidFrame *p_frame) {
+    _variables.print(p_frame, _floatDecimalPlaces);
+  }
+
+  LiquidVariables<Ts...> _variables; ///< The variables of the line
+};
+
+/// Creates a LiquidTypedLine.
+/**
+@param column - the column at which the line starts
+@param row - the row at which the line is printed
+@param &&variables - any number of variables/constants to be printed
+@returns the line holding the variables with their own types
+*/
+template <typename... Ts>
+LiquidTypedLine<Ts...> make_liquidLine(uint8_t column, uint8_t row,
+                                       Ts &&... variables) {
+  return LiquidTypedLine<Ts...>(column, row, static_cast<Ts &&>(variables)...);
+}
+
+
+/// The base of the screens shown on the display.
+/**
+A screen is made up of LiquidLine objects. It holds pointers to them and
+calls their functions when it is active. It also knows on which line the
+focus is. The pointers are stored by the derived classes: LiquidScreen
+holds up to `MAX_LINES` of them and LiquidSizedScreen as many as its
+template argument. The objects of these classes go into a LiquidMenu
+object which controls them. The public methods are for configuration only.
+
+@see LiquidScreen
+@see LiquidSizedScreen
+@see LiquidLine
+*/
+class LiquidScreenBase {
+  friend class LiquidMenuBase;
+
+public:
+
+  /// @name Public methods
+  ///@{
+
+  /// Adds a LiquidLine object to the screen.
+  /**
+  @param &liquidLine - pointer to a LiquidLine object
+  @returns true on success and false if the maximum amount of lines
+  has been reached
+
+  @note The maximum amount of lines per screen is specified in
+  LiquidMenu_config.h as `MAX_LINES` or by the template argument of
+  LiquidSizedScreen. The default is 12.
+
+  @see LiquidMenu_config.h
+  @see MAX_LINES
+  */
+  bool add_line(LiquidLineBase &liquidLine);
+
+  /// Sets the focus position for the whole screen at once.
+  /**
+  The valid positions are `LEFT` and `RIGHT`. `CUSTOM` is not valid
+  for this function because it needs individual column and row for
+  every line.
+
+  @param position - `LEFT` or `RIGHT`
+  @returns true on success and false if the position specified is
+  invalid
+
+  @note The `Position` is enum class. Use `Position::(member)` when
+  specifying the position.
+
+  @see Position
+  */
+  virtual bool set_focusPosition(Position position);
+
+  /// Specifies the line size of the display (required for scrolling).
+  /**
+  This is required when you want to add more lines (LiquidLine
+  objects) to a screen (LiquidScreen object) than the display's line
+  size. The lines will be scrolled. A LiquidListScreen takes it as the
+  count of the rows used by its items.
+
+  @param lineCount - the line size of the display
+
+  @warning Set this after adding all the "lines" to the "screen"!
+  @warning Scrolling currently only works with "focusable" lines!
+  */
+  virtual void set_displayLineCount(uint8_t lineCount);
+
+  /// Hides the screen.
+  /**
+  Hiding a screen means that it will be skipped when cycling the
+  screens.
+
+  @param hide - true for hiding and false for unhiding
+
+  @note It can still be shown using the `change_screen` methods.
 
   @see LiquidMenu::change_screen(LiquidScreen p_liquidScreen)
   @see LiquidMenu::change_screen(uint8_t number)
   */
-  void hide(bool hide);
-  ///@}
+  void hide(bool hide);
+  ///@}
+
+private:
+  /// Prints the lines pointed by the screen.
+  /**
+  Calls the `LiquidLineBase::print(LiquidFrame *p_frame, bool isFocused)`
+  for every line pointed by the screen.
+
+  @param *p_frame - pointer to the LiquidFrame object
+  */
+  void print(LiquidFrame *p_frame) const;
+
+  /// Finds the lines that fit on the display.
+  /**
+  @param &first - the index of the first visible line
+  @param &count - the count of the visible lines
+  */
+  void get_visibleLines(uint8_t &first, uint8_t &count) const;
+
+  /// Marks the visible lines whose refresh period has elapsed.
+  /**
+  @param now - the current time in milliseconds
+  @param elapsed - milliseconds since the previous check
+  @param &wait - milliseconds until the next redraw, lowered to the time
+  until the screen's next line is due
+  @returns true if any line is due
+  */
+  bool schedule_refresh(uint32_t now, uint32_t elapsed, uint16_t &wait);
+
+  /// Marks the visible lines whose getters returned new values.
+  /**
+  @returns true if any line is marked
+  */
+  bool mark_changedLines();
+
+  /// Switches the focus.
+  /**
+  Switches the focus to the next or previous line
+  according to the passed parameter.
+  
+  @note After one iteration through the focusable lines is completed, the focus
+  indicator will hide for one step. To disable this behavior set
+  `LM_FOCUS_INDICATOR_GHOSTING` to false in `LiquiMenu_config.h`
+  @note Only lines that have had a function attached via
+  `LiquidLine::attach_function()` are focusable. If no line on the
+  screen is focusable, the focus indicator stays hidden and this call
+  has no visible effect.
+
+  @param forward - true for forward, false for backward
+  */
+  virtual void switch_focus(bool forward = true);
+
+  /// Directly select focused line.
+  /**
+  @note A line only becomes focusable after `LiquidLine::attach_function()`
+  has been called on it, even with a no-op function used purely to
+  enable focus (see `examples/F_focus_menu`).
+
+  @param lineIndex - index of the focused line
+  @return true: on success, false: when the selected line doesn't exist or it isn't focusable
+  */
+  virtual bool set_focusedLine(uint8_t lineIndex);
+
+  /// Get the index of the currently focused line.
+  /**
+  @returns the index of the currently focused line
+  */
+  uint8_t get_focusedLine() const;
+
+  /// Check if there is an attached function at the specified number.
+  /**
+  @param number - number of the function in the array
+  @returns true if there is a function at the specified number
+
+  @note Function numbering starts from 1.
+
+  @see bool LiquidLine::attach_function(uint8_t number, void (*function)(void))
+  */
+  bool is_callable(uint8_t number) const;
+
+  /// Calls an attached function specified by the number.
+  /**
+  Calls the function specified by the number argument for the focused line.
+
+  @param number - number of the function in the array
+  @returns true if there is a function at the specified number
+
+  @note Function numbering starts from 1.
+
+  @see bool LiquidLine::attach_function(uint8_t number, void (*function)(void))
+  */
+  bool call_function(uint8_t number) const;
+
+protected:
+  /// The constructor used by the derived classes.
+  /**
+  @param **p_liquidLine - array for the pointers to the lines
+  @param lineCapacity - the size of the array
+  @param *p_focusableBits - array for the mask of the focusable lines,
+  one bit per line
+  @param focusableCapacity - the count of the lines that fit in the mask,
+  the lines after them can't be focused
+  */
+  LiquidScreenBase(LiquidLineBase **p_liquidLine, uint8_t lineCapacity,
+                   uint8_t *p_focusableBits, uint8_t focusableCapacity);
+
+  /// Copies a screen into other arrays for the lines and the mask.
+  /**
+  @param &other - the copied screen
+  @param **p_liquidLine - array for the pointers to the lines, as big as
+  the copied screen's
+  @param *p_focusableBits - array for the mask of the focusable lines, as
+  big as the copied screen's
+  */
+  LiquidScreenBase(const LiquidScreenBase &other, LiquidLineBase **p_liquidLine,
+                   uint8_t *p_focusableBits);
+
+  /// Sets the count of lines of a screen that doesn't keep them in an array.
+  /**
+  @param lineCount - the count of lines
+  */
+  void set_lineCount(uint8_t lineCount);
+
+  /// Moves the focus without checking if the line is focusable.
+  /**
+  @param lineIndex - index of the focused line, the count of lines hides
+  the focus
+  */
+  void set_focus(uint8_t lineIndex);
+
+  /// Returns a line of the screen.
+  /**
+  @param index - index of the line
+  @returns pointer to the line
+  */
+  virtual LiquidLineBase* get_line(uint8_t index) const;
+
+private:
+  LiquidScreenBase(const LiquidScreenBase &other) = delete;
+  LiquidScreenBase& operator=(const LiquidScreenBase &other) = delete;
+
+  /// Rebuilds the mask of the focusable lines.
+  void build_focusableLines();
+
+  /// Rebuilds the mask of the focusable lines if a line became focusable.
+  void update_focusableLines();
+
+  LiquidLineBase **_p_liquidLine; ///< The LiquidLine objects
+  uint8_t _lineCapacity; ///< Maximum count of the LiquidLine objects
+  uint8_t _lineCount; ///< Count of the LiquidLine objects
+  uint8_t _focus; ///< Index of the focused line
+  uint8_t _displayLineCount; ///< The number of lines the display supports
+  bool _hidden; ///< If hidden skips this screen when cycling
+  LiquidIndexMask _focusableLines; ///< The focusable lines
+  /// `LiquidLineBase::_focusableChanges` when the mask was built
+  uint16_t _focusableSync;
+
+  /// Counts the changes of the screens' `hide()` state, the menus rebuild
+  /// their masks of hidden screens when it changes.
+  static uint16_t _hiddenChanges;
+};
+
+
+/// Represents a screen shown on the display.
+/**
+Holds up to `MAX_LINES` lines.
+
+@see LiquidScreenBase
+@see LiquidSizedScreen
+*/
+class LiquidScreen : public LiquidScreenBase {
+public:
+
+  /// @name Constructors
+  ///@{
+
+  /// The main constructor.
+  /**
+  This is the main constructor that gets called every time.
+  */
+  LiquidScreen();
+
+  /// Constructor for 1 LiquidLine object.
+  /**
+  @param &liquidLine - pointer to a LiquidLine object
+  */
+  explicit LiquidScreen(LiquidLineBase &liquidLine);
+
+  /// Constructor for 2 LiquidLine object.
+  /**
+  @param &liquidLine1 - pointer to a LiquidLine object
+  @param &liquidLine2 - pointer to a LiquidLine object
+  */
+  LiquidScreen(LiquidLineBase &liquidLine1, LiquidLineBase &liquidLine2);
+
+  /// Constructor for 3 LiquidLine object.
+  /**
+  @param &liquidLine1 - pointer to a LiquidLine object
+  @param &liquidLine2 - pointer to a LiquidLine object
+  @param &liquidLine3 - pointer to a LiquidLine object
+  */
+  LiquidScreen(LiquidLineBase &liquidLine1, LiquidLineBase &liquidLine2,
+               LiquidLineBase &liquidLine3);
+
+  /// Constructor for 4 LiquidLine object.
+  /**
+  @param &liquidLine1 - pointer to a LiquidLine object
+  @param &liquidLine2 - pointer to a LiquidLine object
+  @param &liquidLine3 - pointer to a LiquidLine object
+  @param &liquidLine4 - pointer to a LiquidLine object
+  */
+  LiquidScreen(LiquidLineBase &liquidLine1, LiquidLineBase &liquidLine2,
+               LiquidLineBase &liquidLine3, LiquidLineBase &liquidLine4);
+
+  /// The copy constructor.
+  /**
+  @param &other - the copied screen
+  */
+  LiquidScreen(const LiquidScreen &other);
+
+  ///@}
+
+private:
+  LiquidLineBase *_liquidLine[MAX_LINES]; ///< Storage for the lines
+  uint8_t _focusableBits[(MAX_LINES + 7) / 8]; ///< Storage for the mask
+};
+
+
+/// Represents a screen holding up to `N` lines.
+/**
+Reserves exactly as much memory for the pointers to the lines as needed,
+instead of `MAX_LINES` for every screen. Create it directly or with
+`make_liquidScreen()`:
+
+~~~{.cpp}
+LiquidSizedScreen<3> status_screen(temperature_line, humidity_line);
+auto welcome_screen = make_liquidScreen(welcome_line1, welcome_line2);
+~~~
+
+@tparam N - the maximum count of lines
+
+@see LiquidScreenBase
+@see make_liquidScreen
+*/
+template <uint8_t N>
+class LiquidSizedScreen : public LiquidScreenBase {
+  static_assert(N > 0, "LiquidSizedScreen needs room for at least one line");
+
+public:
+  /// The main constructor.
+  LiquidSizedScreen()
+    : LiquidScreenBase(_liquidLine, N, _focusableBits, N) {}
+
+  /// Constructor for one or more LiquidLine objects.
+  /**
+  @param &liquidLine - the first line
+  @param &liquidLines - more lines
+  */
+  template <typename... Ls>
+  explicit LiquidSizedScreen(LiquidLineBase &liquidLine, Ls &... liquidLines)
+    : LiquidSizedScreen() {
+    static_assert(sizeof...(Ls) < N, "Too many lines for the LiquidSizedScreen");
+    add_lines(liquidLine, liquidLines...);
+  }
+
+  /// The copy constructor.
+  /**
+  @param &other - the copied screen
+  */
+  LiquidSizedScreen(const LiquidSizedScreen &other)
+    : LiquidScreenBase(other, _liquidLine, _focusableBits) {}
+
+private:
+  /// Adds the lines passed to the constructor one by one.
+  void add_lines() {}
+
+  template <typename... Ls>
+  void add_lines(LiquidLineBase &liquidLine, Ls &... liquidLines) {
+    add_line(liquidLine);
+    add_lines(liquidLines...);
+  }
+
+  LiquidLineBase *_liquidLine[N]; ///< Storage for the lines
+  uint8_t _focusableBits[(N + 7) / 8]; ///< Storage for the mask
+};
+
+/// Creates a LiquidSizedScreen with room for exactly the passed lines.
+/**
+@param &liquidLines - the lines of the screen
+@returns the screen holding the lines
+*/
+template <typename... Ls>
+LiquidSizedScreen<sizeof...(Ls)> make_liquidScreen(Ls &... liquidLines) {
+  return LiquidSizedScreen<sizeof...(Ls)>(liquidLines...);
+}
+
+
+/// The line printing the visible items of a LiquidListScreen.
+/**
+A list screen has one such line which is moved to every visible row and
+prints the item of that row through the screen's item provider.
+
+@see LiquidListScreen
+*/
+class LiquidListLine : public LiquidLineBase {
+  friend class LiquidListScreen;
+
+private:
+  /// The main constructor.
+  /**
+  @param *provider - the function printing an item
+  @param column - the column at which the items start
+  */
+  LiquidListLine(void (*provider)(uint16_t index, Print &output), uint8_t column);
+
+  /// Prints the current item through the provider.
+  /**
+  @param *p_frame - pointer to the LiquidFrame object
+  */
+  virtual void print_variables(LiquidFrame *p_frame);
+
+  void (*_provider)(uint16_t index, Print &output); ///< Prints an item
+  uint16_t _item; ///< Index of the item printed by the line
+};
+
+
+/// Represents a screen listing any number of items.
+/**
+The items aren't kept in RAM, a provider function prints item *i* only
+when its row is visible:
+
+~~~{.cpp}
+void print_channel(uint16_t index, Print &output) {
+  output.print("Channel ");
+  output.print(index + 1);
+}
+LiquidListScreen channel_screen(print_channel, 500, 2);
+~~~
+
+The focus and the scroll position are kept as item indexes and the
+screen takes the same RAM regardless of the count of the items. The
+functions attached to the screen are shared by all items, they can
+find the focused item with `get_focusedItem()`.
+
+The items can start below the first row, with a header line above them
+which doesn't scroll:
+
+~~~{.cpp}
+LiquidLine channels_line(0, 0, "Channels");
+LiquidListScreen channel_screen(print_channel, 500, 3, 0, 1);
+channel_screen.set_header(channels_line);
+~~~
+
+@note The refresh periods and the getter change detection don't apply
+to the items, call `LiquidMenu::softUpdate()` when they change. They
+apply to the header line.
+*/
+class LiquidListScreen : public LiquidScreenBase {
+public:
+  /// @name Constructors
+  ///@{
+
+  /// The main constructor.
+  /**
+  @param *provider - the function printing an item, it receives the
+  item's index and the output to print to
+  @param itemCount - the count of the items
+  @param rows - the count of the display's rows used by the list
+  @param column - the column at which the items start
+  @param row - the row of the first visible item
+  */
+  LiquidListScreen(void (*provider)(uint16_t index, Print &output),
+                   uint16_t itemCount, uint8_t rows, uint8_t column = 0,
+                   uint8_t row = 0);
+
+  ///@}
+
+  /// @name Public methods
+  ///@{
+
+  /// Attaches a callback function to the items.
+  /**
+  Makes the items focusable.
+
+  @param number - function number used for identification
+  @param *function - pointer to the function
+  @returns true on success and false if there are no more line slots
+
+  @see LiquidLineBase::attach_function(uint8_t number, void (*function)(void))
+  */
+  bool attach_function(uint8_t number, void (*function)(void));
+
+  /// Shows a line above the items.
+  /**
+  The line is printed at its own position and doesn't scroll, give the
+  items a first row below it with the constructor. It's the screen's line
+  0, the items' lines follow it. The line isn't focused with the items.
+
+  @param &header - the header line
+  */
+  void set_header(LiquidLineBase &header);
+
+  /// Changes the count of the items.
+  /**
+  The focus and the scroll position are kept if they're still valid.
+
+  @param itemCount - the count of the items
+  */
+  void set_itemCount(uint16_t itemCount);
+
+  /// Returns the count of the items.
+  /**
+  @returns the count of the items
+  */
+  uint16_t get_itemCount() const;
+
+  /// Changes the count of the display's rows used by the list.
+  /**
+  The header line isn't counted.
+
+  @param rows - the count of the rows
+  */
+  virtual void set_displayLineCount(uint8_t rows);
+
+  /// Focuses an item and scrolls to it.
+  /**
+  @param index - the index of the item
+  @returns true on success and false if there is no such item or the
+  items are not focusable
+  */
+  bool set_focusedItem(uint16_t index);
+
+  /// Returns the index of the focused item.
+  /**
+  @returns the index of the focused item or `NO_ITEM` when the focus is
+  hidden
+  */
+  uint16_t get_focusedItem() const;
+
+  /// Returns the index of the first visible item.
+  /**
+  @returns the index of the item on the first row
+  */
+  uint16_t get_firstItem() const;
+  ///@}
+
+private:
+  LiquidListScreen(const LiquidListScreen &other) = delete;
+  LiquidListScreen& operator=(const LiquidListScreen &other) = delete;
+
+  /// Moves the focus to the next or previous item.
+  /**
+  The list scrolls to keep the focused item visible.
+
+  @param forward - true for forward, false for backward
+  */
+  virtual void switch_focus(bool forward = true);
+
+  /// Focuses a visible item by its row.
+  /**
+  @param lineIndex - the row of the item
+  @returns true on success and false if there is no item on the row or
+  the items are not focusable
+  */
+  virtual bool set_focusedLine(uint8_t lineIndex);
+
+  /// Returns the header line or moves the items' line to a visible row.
+  /**
+  @param index - the index of the line, the header's is 0
+  @returns pointer to the line, valid until the next row is requested
+  */
+  virtual LiquidLineBase* get_line(uint8_t index) const;
+
+  /// Returns the count of the lines before the items.
+  /**
+  @returns 1 with a header line, otherwise 0
+  */
+  uint8_t get_headerCount() const;
+
+  /// Scrolls to the focused item and updates the visible rows.
+  void update_window();
+
+  mutable LiquidListLine _line; ///< Prints the visible items
+  LiquidLineBase *_p_header; ///< The line above the items or nullptr
+  uint16_t _itemCount; ///< The count of the items
+  uint16_t _firstItem; ///< Index of the item on the first row
+  uint16_t _focusedItem; ///< Index of the focused item or `NO_ITEM`
+  uint8_t _rows; ///< The count of the rows used by the list
+  uint8_t _firstRow; ///< The row of the first visible item
+};
+
+
+/// Rendering statistics of a menu.
+/**
+Counts the commands that the menu sends to the display and measures how
+long the rendering takes. The counters are always updated, they don't
+need a debug build and don't print anything.
+
+@note Only the commands sent by the menu are counted, writing to the
+display directly isn't.
+
+@see LiquidMenu::get_stats()
+*/
+struct LiquidStats {
+  uint32_t frames; ///< Count of the rendered frames
+  uint32_t characters; ///< Count of the characters sent to the display
+  uint32_t cursorMoves; ///< Count of the cursor positionings
+  uint32_t rewrites; ///< Count of the unchanged characters rewritten between runs
+  uint32_t clears; ///< Count of the display clears
+  uint32_t glyphUploads; ///< Count of the glyphs uploaded to CGRAM
+  uint32_t lastRenderUs; ///< Duration of the last render in microseconds
+  uint32_t maxRenderUs; ///< Duration of the longest render in microseconds
+};
+
+
+/// The commands a menu sends to a display.
+/**
+The menus drive the displays through this interface, so displays of
+different types can be used in one program. `LiquidTypedDriver` implements
+it for any class with the methods of the `LiquidCrystal` library. Other
+hardware can be driven by implementing it directly.
+
+The menus send the changed characters in runs through `write_at()`. By
+default it positions the cursor and writes the characters one by one, a
+driver which can send a whole run in one bus transaction overrides it
+or `write(const uint8_t*, uint8_t)`.
+
+Two runs separated by a few unchanged characters are sent as one when
+rewriting the unchanged characters costs less than positioning the
+cursor, as told by `get_cursorCost()` and `get_characterCost()`.
+
+The methods are virtual so that one copy of the menu's code drives every
+type of display. A menu calls the driver about once per run of changed
+characters, 5 to 16 times for a 16x2 screen, the indirect calls add a
+few microseconds to a render which spends milliseconds on the bus.
+
+@see LiquidTypedDriver
+@see make_liquidDriver
+*/
+class LiquidDisplayDriver {
+public:
+  /// Clears the display and moves the cursor home.
+  virtual void clear() = 0;
+
+  /// Positions the cursor.
+  /**
+  @param column - the column
+  @param row - the row
+  */
+  virtual void setCursor(uint8_t column, uint8_t row) = 0;
+
+  /// Writes a character at the cursor and advances it.
+  /**
+  @param character - the character
+  */
+  virtual void write(uint8_t character) = 0;
+
+  /// Writes characters at the cursor and advances it.
+  /**
+  Writes the characters one by one with `write(uint8_t)`.
+
+  @param buffer - the characters
+  @param size - the count of the characters
+  */
+  virtual void write(const uint8_t *buffer, uint8_t size) {
+    for (uint8_t i = 0; i < size; i++) {
+      write(buffer[i]);
+    }
+  }
+
+  /// Positions the cursor and writes characters.
+  /**
+  Calls `setCursor()` and `write(const uint8_t*, uint8_t)`.
+
+  @param column - the column of the first character
+  @param row - the row
+  @param buffer - the characters
+  @param size - the count of the characters
+  */
+  virtual void write_at(uint8_t column, uint8_t row,
+                        const uint8_t *buffer, uint8_t size) {
+    setCursor(column, row);
+    write(buffer, size);
+  }
+
+  /// The cost of positioning the cursor between two runs.
+  /**
+  In the same unit as `get_characterCost()`, e.g. bytes on the bus. By
+  default positioning the cursor costs as much as writing a character,
+  like on a parallel HD44780.
+
+  @returns the cost of positioning the cursor
+  */
+  virtual uint8_t get_cursorCost() const {
+    return 1;
+  }
+
+  /// The cost of writing a character.
+  /**
+  @returns the cost of writing a character
+  @see get_cursorCost()
+  */
+  virtual uint8_t get_characterCost() const {
+    return 1;
+  }
+
+  /// Uploads a glyph to the display's CGRAM.
+  /**
+  @param index - the glyph's index
+  @param glyph[] - the glyph's bitmap
+  */
+  virtual void createChar(uint8_t index, uint8_t glyph[8]) = 0;
+
+protected:
+  /// Not virtual, the drivers aren't destroyed through this class.
+  ~LiquidDisplayDriver() {}
+};
+
+
+/// Drives a display of type `D`.
+/**
+Calls the methods of `D` directly, the type is known at compile time and
+any number of display types can be used together:
+
+~~~{.cpp}
+LiquidCrystal front_lcd(12, 11, 5, 4, 3, 2);
+LiquidCrystal_I2C rear_lcd(0x27, 16, 2);
+auto rear_driver = make_liquidDriver(rear_lcd);
+LiquidMenu menu(front_lcd, welcome_screen);
+LiquidMenu rear_menu(rear_driver, status_screen);
+~~~
+
+A run of characters is written with `D::write(const uint8_t*, size_t)`
+when `D` has it (the `Print` classes do), so a display library which sends
+a buffer in one burst is used that way. The costs of the commands are
+taken from `D::get_cursorCost()` and `D::get_characterCost()` when `D`
+has them.
+
+@tparam D - the class of the display, with the methods `clear()`,
+`setCursor()`, `write()` and `createChar()`
+
+@see make_liquidDriver
+*/
+template <class D>
+class LiquidTypedDriver : public LiquidDisplayDriver {
+  friend class LiquidMenuBase;
+
+public:
+  /// The main constructor.
+  /**
+  @param &display - the display
+  */
+  explicit LiquidTypedDriver(D &display)
+    : _p_display(&display) {}
+
+  virtual void clear() {
+    _p_display->clear();
+  }
+
+  virtual void setCursor(uint8_t column, uint8_t row) {
+    _p_display->setCursor(column, row);
+  }
+
+  virtual void write(uint8_t character) {
+    _p_display->write(character);
+  }
+
+  virtual void write(const uint8_t *buffer, uint8_t size) {
+    write_buffer(_p_display, buffer, size, 0);
+  }
+
+  virtual uint8_t get_cursorCost() const {
+    return cursor_cost(_p_display, 0);
+  }
+
+  virtual uint8_t get_characterCost() const {
+    return character_cost(_p_display, 0);
+  }
+
+  virtual void createChar(uint8_t index, uint8_t glyph[8]) {
+    _p_display->createChar(index, glyph);
+  }
+
+private:
+  /// Writes a buffer with the display's own buffer write.
+  template <typename T>
+  static auto write_buffer(T *p_display, const uint8_t *buffer, uint8_t size, int)
+    -> decltype(p_display->write(buffer, (size_t)size), void()) {
+    p_display->write(buffer, (size_t)size);
+  }
+
+  /// Writes a buffer one character at a time, for displays without a buffer write.
+  template <typename T>
+  static void write_buffer(T *p_display, const uint8_t *buffer, uint8_t size, long) {
+    for (uint8_t i = 0; i < size; i++) {
+      p_display->write(buffer[i]);
+    }
+  }
+
+  /// The display's own cost of positioning the cursor.
+  template <typename T>
+  static auto cursor_cost(T *p_display, int) -> decltype(p_display->get_cursorCost()) {
+    return p_display->get_cursorCost();
+  }
+
+  /// The default cost of positioning the cursor.
+  template <typename T>
+  static uint8_t cursor_cost(T *, long) {
+    return 1;
+  }
+
+  /// The display's own cost of writing a character.
+  template <typename T>
+  static auto character_cost(T *p_display, int) -> decltype(p_display->get_characterCost()) {
+    return p_display->get_characterCost();
+  }
+
+  /// The default cost of writing a character.
+  template <typename T>
+  static uint8_t character_cost(T *, long) {
+    return 1;
+  }
+
+  /// Creates a driver without a display, used by the menus until one is given.
+  LiquidTypedDriver()
+    : _p_display(nullptr) {}
+
+  D *_p_display; ///< The display
+};
+
+/// Creates a LiquidTypedDriver for a display.
+/**
+@param &display - the display
+@returns the driver of the display
+*/
+template <class D>
+LiquidTypedDriver<D> make_liquidDriver(D &display) {
+  return LiquidTypedDriver<D>(display);
+}
+
+
+/// A display showing a menu.
+/**
+Keeps what the display currently shows and which glyphs are uploaded to
+it, so that the display is sent only the characters that differ from the
+printed frame. Every menu has one for the display passed to its
+constructor, the menus built for the same `DisplayClass` object or driver
+draw on the first one's, so that they share what it shows. More are added
+with
+`LiquidMenu::add_display()` to mirror the menu on other displays:
+
+~~~{.cpp}
+LiquidCrystal rear_lcd(8, 9, 4, 5, 6, 7);
+auto rear_driver = make_liquidDriver(rear_lcd);
+LiquidDisplay rear_display(rear_driver);
+menu.add_display(rear_display);
+~~~
+
+The screen is printed once and every display is sent its own changes.
+The same LiquidDisplay can be added to all of the menus of a LiquidSystem,
+they share what it shows.
+
+The position of the display's cursor is followed too, a run of characters
+which starts where the previous one ended is written without positioning
+the cursor.
+*/
+class LiquidDisplay {
+  friend class LiquidMenuBase;
+  friend class LiquidSystem;
+
+public:
+  /// The main constructor.
+  /**
+  The display is expected to be cleared by its initialization.
+
+  @param &driver - the display's driver
+  */
+  explicit LiquidDisplay(LiquidDisplayDriver &driver);
+
+  /// Sets the size of an HD44780 display.
+  /**
+  The cursor of an HD44780 moves through its memory, after the last
+  column of a row it continues on another row (on a 20x4 display row 0
+  continues on row 2, row 2 on row 1 and row 1 on row 3). With the size
+  known the rows are written in that order and a row which continues the
+  previous one is written without positioning the cursor. Cells outside
+  of the display aren't written.
+
+  @param columns - the count of columns of the display
+  @param rows - the count of rows of the display (1 - 4)
+  @returns true on success and false if the display is larger than the
+  frame, the columns and rows outside of `MAX_COLUMNS` and `MAX_ROWS`
+  aren't shown
+
+  @see MAX_COLUMNS
+  @see MAX_ROWS
+  */
+  bool set_size(uint8_t columns, uint8_t rows);
+
+  /// Takes over what another display object knows about the display.
+  /**
+  Copies what the display shows, its glyphs, its size and the position
+  of its cursor, but keeps this object's driver. Use it when a display
+  which was drawn on through another object, e.g. with another driver,
+  is added as a mirror, so that only the differing characters are sent.
+
+  @param &other - the object which last drew on the display
+  */
+  void adopt_state(const LiquidDisplay &other);
+
+private:
+  /// The address of a cell in the display's memory.
+  /**
+  Without a known size the address only follows the row.
+
+  @param row - the row
+  @param column - the column
+  @returns the address
+  */
+  uint16_t get_address(uint8_t row, uint8_t column) const;
+
+  /// Moves the cursor after writing characters.
+  /**
+  @param count - the count of the written characters
+  */
+  void advance_cursor(uint8_t count);
+
+  LiquidDisplayDriver *_p_driver; ///< The display's driver
+  uint8_t _shadow[MAX_ROWS][MAX_COLUMNS]; ///< What the display currently shows
+  LiquidGlyphSlots _glyphSlots; ///< The glyphs on the display
+  uint8_t _columns; ///< The count of columns of an HD44780 or 0
+  uint8_t _rows; ///< The count of rows of an HD44780 or 0
+  uint16_t _cursor; ///< The address of the cursor or `NO_CURSOR`
+};
+
+
+/// The base of the menus.
+/**
+A menu is made up of LiquidScreen objects. It holds pointers to them and
+calls their functions depending on which one is active. This is the class
+used for control. It is possible to use multiple menus, it that case this
+classes' objects go into a LiquidSystem object which controls them using
+the same public methods. The pointers are stored by the derived classes:
+LiquidMenu holds up to `MAX_SCREENS` of them and LiquidSizedMenu as many
+as its template argument.
+
+@see LiquidMenu
+@see LiquidSizedMenu
+@see LiquidScreen
+*/
+class LiquidMenuBase {
+  friend class LiquidSystem;
+  friend class LiquidFrame;
+
+public:
+
+  /// @name Public methods
+  ///@{
+
+  /// Adds a LiquidScreen object to the menu.
+  /**
+  @param &liquidScreen - pointer to a LiquidScreen object
+  @returns true on success and false if the maximum amount of screens
+  has been reached
+
+  @note The maximum amount of screens per menu is specified in
+  LiquidMenu_config.h as `MAX_SCREENS` or by the template argument of
+  LiquidSizedMenu. The default is 14.
+
+  @see LiquidMenu_config.h
+  @see MAX_SCREENS
+  */
+  bool add_screen(LiquidScreenBase &liquidScreen);
+
+  /// Adds a display mirroring the menu.
+  /**
+  The mirrored display shows the same screen as the menu's own display.
+  It should be cleared and have the same size.
+
+  @param &display - the mirrored display's state
+  @returns true on success and false if the maximum amount of displays
+  has been reached
+
+  @note The maximum amount of mirrored displays per menu is specified in
+  LiquidMenu_config.h as `MAX_MIRRORS`. The default is 1.
+
+  @see LiquidDisplay
+  */
+  bool add_display(LiquidDisplay &display);
+
+  /// Sets the size of the menu's HD44780 displays.
+  /**
+  Applies `LiquidDisplay::set_size()` to the menu's own display and the
+  mirrored displays added before.
+
+  @param columns - the count of columns of the displays
+  @param rows - the count of rows of the displays (1 - 4)
+  @returns true on success and false if the displays are larger than the
+  frame (`MAX_COLUMNS`, `MAX_ROWS`)
+
+  @see LiquidDisplay::set_size()
+  */
+  bool set_displaySize(uint8_t columns, uint8_t rows);
+
+  /// Returns a reference to the current screen.
+  /**
+  Call this method to obtain a reference to the current screen.
+
+  @returns a pointer to the current screen.
+  */
+  LiquidScreenBase* get_currentScreen() const;
+
+  /// Switches to the next screen.
+  void next_screen();
+
+  /// Switches to the next screen.
+  /**
+  @note Prefix increment operator overloading.
+  */
+  void operator++();
+
+  /// Switches to the next screen.
+  /**
+  @note Postfix increment operator overloading.
+  */
+  void operator++(int);
+
+  /// Switches to the previous screen.
+  void previous_screen();
+
+  /// Switches to the previous screen.
+  /**
+  @note Prefix decrement operator overloading.
+  */
+  void operator--();
+
+  /// Switches to the previous screen.
+  /**
+  @note Postfix decrement operator overloading.
+  */
+  void operator--(int);
+
+  /// Switches to the specified screen.
+  /**
+  @param *p_liquidScreen - pointer to the LiquidScreen object
+  @returns true on success and false if the screen is not found
+  */
+  bool change_screen(LiquidScreenBase *p_liquidScreen);
+
+  /// Switches to the specified screen.
+  /**
+  @param number - the number of the screen
+  @returns true on success and false if the
+  number of the screen is invalid.
+  */
+  bool change_screen(uint8_t number);
 
-private:
-  /// Prints the lines pointed by the screen.
+  /// Switches to the specified screen.
   /**
-  Calls the `LiquidLine::print(DisplayClass *p_liquidCrystal, bool isFocused)`
-  for every line pointed by the screen.
+  @param &p_liquidScreen - pointer to the screen
+  @returns true on success and false if the screen is not found
+  */
+  bool operator=(LiquidScreenBase *p_liquidScreen);
 
-  @param *p_liquidCrystal - pointer to the DisplayClass object
+  /// Switches to the specified screen.
+  /**
+  @param number - the number of the screen
+  @returns true on success and false if the
+  number of the screen is invalid.
   */
-  void print(DisplayClass *p_liquidCrystal) const;
+  bool operator=(uint8_t number);
 
-  /// Switches the focus.
+  /// Switches the focus
   /**
   Switches the focus to the next or previous line
   according to the passed parameter.
-  
-  @note After one iteration through the focusable lines is completed, the focus
-  indicator will hide for one step. To disable this behavior set
-  `LM_FOCUS_INDICATOR_GHOSTING` to false in `LiquiMenu_config.h`
+
   @note Only lines that have had a function attached via
   `LiquidLine::attach_function()` are focusable. If no line on the
-  screen is focusable, the focus indicator stays hidden and this call
-  has no visible effect.
+  current screen is focusable, the focus indicator stays hidden and
+  this call has no visible effect.
 
   @param forward - true for forward, false for backward
   */
   void switch_focus(bool forward = true);
-
+  
   /// Directly select focused line.
   /**
   @note A line only becomes focusable after `LiquidLine::attach_function()`
@@ -751,6 +2591,57 @@ private:
   */
   uint8_t get_focusedLine() const;
 
+  /// Sets the focus position for the whole menu at once.
+  /**
+  The valid positions are `LEFT` and `RIGHT`. `CUSTOM` is not valid
+  for this function because it needs individual column and row for
+  every line.
+
+  @param position - `LEFT` or `RIGHT`
+  @returns true on success and false if the position specified is
+  invalid
+
+  @note The `Position` is enum class. Use `Position::(member)` when
+  specifying the position.
+
+  @see Position
+  */
+  bool set_focusPosition(Position position);
+
+  /// Changes the focus indicator's symbol.
+  /**
+  The symbol is changed for a particular position.
+
+  @param position - the position for which the symbol will be changed
+  @param symbol[] - the symbol
+  @returns true on success and false if the position specified is
+  invalid
+
+  @note The `Position` is enum class. Use `Position::(member)` when
+  specifying the position.
+
+  @note The symbol isn't copied, it's uploaded to the display when the
+  focus indicator is shown. The array must not be a local variable.
+
+  @see Position
+  */
+  bool set_focusSymbol(Position position, uint8_t symbol[8]);
+
+  /// Reserves a glyph slot for a glyph created by the user.
+  /**
+  The menu uploads the glyphs of the lines and the focus indicator to the
+  free or least recently used slots of the display's CGRAM. Reserve the
+  slots of the glyphs created with `createChar()` so that they aren't
+  replaced before a line printing them by index is shown.
+
+  @param index - the glyph's index (0 - 7)
+  @returns true on success and false if the index is invalid
+
+  @see LiquidLine::set_asGlyph(uint8_t number)
+  @see LiquidGlyphSlots
+  */
+  bool reserve_glyphSlot(uint8_t index);
+
   /// Check if there is an attached function at the specified number.
   /**
   @param number - number of the function in the array
@@ -764,38 +2655,403 @@ private:
 
   /// Calls an attached function specified by the number.
   /**
-  Calls the function specified by the number argument for the focused line.
+  Calls the function specified by the number argument for the current
+  screen and for the focused line.
 
   @param number - number of the function in the array
+  @param refresh - enable/disable updating the display
   @returns true if there is a function at the specified number
 
   @note Function numbering starts from 1.
 
   @see bool LiquidLine::attach_function(uint8_t number, void (*function)(void))
   */
-  bool call_function(uint8_t number) const;
+  bool call_function(uint8_t number, bool refresh = true) const;
 
-  LiquidLine *_p_liquidLine[MAX_LINES]; ///< The LiquidLine objects
-  uint8_t _lineCount; ///< Count of the LiquidLine objects
-  uint8_t _focus; ///< Index of the focused line
-  uint8_t _displayLineCount; ///< The number of lines the display supports
-  bool _hidden; ///< If hidden skips this screen when cycling
+  /// Enables/disables clearing the display on every update.
+  /**
+  When disabled the display is never cleared, every new frame overwrites
+  the previous one and the leftover characters are replaced with spaces.
+  This removes the clear command's delay and flickering from the updates
+  and the screen and focus changes.
+
+  @param clear - true for clearing (default) and false for overwriting
+
+  @note Disable it only when nothing else writes to the display, the
+  menu relies on knowing what the display currently shows.
+  */
+  void set_clearOnUpdate(bool clear);
+
+  /// Enables/disables deferring the updates to `poll()`.
+  /**
+  When enabled `update()` and `softUpdate()` only mark the display as
+  out of date and return immediately. The characters are sent to the
+  display by `poll()`, which should be called from `loop()`.
+
+  @param deferred - true for deferring and false for updating immediately
+  (default)
+
+  @note Call `poll()` until it returns true before disabling it, the
+  pending changes are otherwise shown only after the next update.
+
+  @see poll(uint32_t budgetUs)
+  */
+  void set_deferredUpdate(bool deferred);
+
+  /// Sends the pending changes to the display within a time budget.
+  /**
+  Prints the current screen and sends as many of the changed characters
+  as fit in the time budget. The rest are sent on the next calls. This
+  bounds the time spent in every call regardless of the screen's content.
+  At least one character is sent on every call, so the update finishes
+  even with a budget shorter than printing the screen.
+
+  @param budgetUs - the time budget in microseconds, 0 for no limit
+  @returns true if the display is up to date and false if there are
+  pending changes left
+
+  @note The display is cleared in one go, which takes longer than the
+  budget of most of the loops.
+
+  @see set_deferredUpdate(bool deferred)
+  */
+  bool poll(uint32_t budgetUs);
+
+  /// Returns the rendering statistics.
+  /**
+  The render duration covers printing the current screen, sending it to
+  the display and clearing the display when `update()` clears it. With
+  deferred updates it covers a single call to `poll()` and a frame is
+  counted when it is sent completely.
+
+  @returns the statistics since the creation of the menu or since the
+  last call to `reset_stats()`
+
+  @see LiquidStats
+  */
+  const LiquidStats& get_stats() const;
+
+  /// Sets all of the rendering statistics to zero.
+  void reset_stats();
+
+  /// Prints the current screen to the display.
+  /**
+  Call this method when there is a change in some of the attached variables.
+
+  @note This method clears the display and then sends all of the current
+  screen's characters. Call it after writing to the display directly.
+  When clearing is disabled with `set_clearOnUpdate(false)` this is the
+  same as `softUpdate()`. With deferred updates the display is only
+  marked as out of date.
+
+  @see set_clearOnUpdate(bool clear)
+  @see set_deferredUpdate(bool deferred)
+  */
+  void update() const;
+
+  /// Prints the current screen to the display (without clearing).
+  /**
+  Call this method when there is a change in some of the variable attached.
+  The current screen is printed into a frame which is compared to what the
+  display currently shows and only the changed characters are sent.
+
+  @note This method doesn't clear the display. With deferred updates the
+  display is only marked as out of date.
+  */
+  void softUpdate() const;
+
+  /// Prints a single line to the display.
+  /**
+  Call this method when only the variables of one line changed. Only the
+  characters of that line are sent to the display, the rest of the screen
+  isn't touched even if it changed.
+
+  @param &liquidLine - the changed line
+
+  @note Nothing is sent if the line isn't on the visible part of the
+  current screen. With deferred updates the display is only marked as
+  out of date.
+  */
+  void refresh_line(LiquidLineBase &liquidLine) const;
+
+  /// Prints a single variable of a line to the display.
+  /**
+  Only the characters of the variable and of the line after it are sent,
+  the following variables move if its width changed.
+
+  @param &liquidLine - the line holding the changed variable
+  @param number - the number of the variable, starting from 1 as in
+  `LiquidLine::set_asGlyph()`
+
+  @note Nothing is sent if the line isn't on the visible part of the
+  current screen. With deferred updates the display is only marked as
+  out of date.
+
+  @see refresh_line(LiquidLineBase &liquidLine)
+  */
+  void refresh_variable(LiquidLineBase &liquidLine, uint8_t number) const;
+
+  /// Redraws the visible lines whose refresh period has elapsed.
+  /**
+  Call this method from `loop()` instead of updating the whole screen
+  periodically. All of the due lines are sent together, the same way as
+  `refresh_line()`.
+
+  @param now - the current time in milliseconds, usually `millis()`
+  @returns the time when the next redraw is due, at most 65535 ms after
+  `now` if no visible line has a refresh period
+
+  @note The first call after another screen became current only starts
+  counting, the screen was just drawn whole. The lines of the flash
+  screens don't have refresh periods.
+
+  @see LiquidLine::set_refreshPeriod(uint16_t period)
+  */
+  uint32_t tick(uint32_t now);
+
+  /// Redraws the visible lines whose getters returned new values.
+  /**
+  Calls the getters of the visible lines (respecting their re-query
+  intervals) and redraws only the lines whose getters returned a value
+  different from the last one. Nothing is printed if there are none.
+
+  @returns true if any line was redrawn
+
+  @note The getters are called once, the lines are printed with the
+  values that were compared. The getters that didn't get one of the
+  `MAX_GETTER_CACHES` caches are always redrawn (the display is still
+  sent only the changed characters). Getters returning `const char*` are
+  compared by the pointer, getters returning `char*` are always
+  considered changed because the text behind the pointer can change.
+
+  @see LiquidLine::set_getterInterval(uint16_t interval)
+  */
+  bool refresh_getters() const;
+
+  /// Initializes the menu object.
+  /**
+  Call this method to fully initialize the menu object. The glyphs
+  uploaded to the display are forgotten and uploaded again when needed.
+
+  @note Call it after reinitializing the display or changing a glyph's
+  bitmap in place.
+  */
+  void init() const;
+
+  ///@}
+
+protected:
+  /// The constructor used by the derived classes.
+  /**
+  @param &liquidCrystal - pointer to the DisplayClass object
+  @param **p_liquidScreen - array for the pointers to the screens
+  @param *p_shownBits - array for the mask of the shown screens, one bit
+  per screen
+  @param screenCapacity - the size of the array
+  @param startingScreen - the number of the screen that will be shown
+  first
+  */
+  LiquidMenuBase(DisplayClass &liquidCrystal, LiquidScreenBase **p_liquidScreen,
+                 uint8_t *p_shownBits, uint8_t screenCapacity,
+                 uint8_t startingScreen);
+
+  /// The constructor used by the derived classes for a display driver.
+  /**
+  @param &driver - the display's driver
+  @param **p_liquidScreen - array for the pointers to the screens
+  @param *p_shownBits - array for the mask of the shown screens, one bit
+  per screen
+  @param screenCapacity - the size of the array
+  @param startingScreen - the number of the screen that will be shown
+  first
+  */
+  LiquidMenuBase(LiquidDisplayDriver &driver, LiquidScreenBase **p_liquidScreen,
+                 uint8_t *p_shownBits, uint8_t screenCapacity,
+                 uint8_t startingScreen);
+
+  /// Copies a menu into other arrays for the screens and the mask.
+  /**
+  @param &other - the copied menu
+  @param **p_liquidScreen - array for the pointers to the screens, as big
+  as the copied menu's
+  @param *p_shownBits - array for the mask of the shown screens, as big as
+  the copied menu's
+  */
+  LiquidMenuBase(const LiquidMenuBase &other, LiquidScreenBase **p_liquidScreen,
+                 uint8_t *p_shownBits);
+
+  /// Hands what the display shows over to the other menus of the display.
+  ~LiquidMenuBase();
+
+private:
+  /// The constructor the other constructors delegate to.
+  /**
+  @param *p_liquidCrystal - the DisplayClass object or nullptr
+  @param *p_driver - the display's driver, used if there is no
+  DisplayClass object
+  @param **p_liquidScreen - array for the pointers to the screens
+  @param *p_shownBits - array for the mask of the shown screens
+  @param screenCapacity - the size of the array
+  @param startingScreen - the number of the screen that will be shown
+  first
+  */
+  LiquidMenuBase(DisplayClass *p_liquidCrystal, LiquidDisplayDriver *p_driver,
+                 LiquidScreenBase **p_liquidScreen, uint8_t *p_shownBits,
+                 uint8_t screenCapacity, uint8_t startingScreen);
+
+  LiquidMenuBase(const LiquidMenuBase &other) = delete;
+  LiquidMenuBase& operator=(const LiquidMenuBase &other) = delete;
+
+  /// Sends the changed characters of a frame to a display.
+  /**
+  Compares the frame to the shadow copy of the display and sends every
+  run of changed characters with one cursor positioning.
+
+  @param &frame - the rendered frame
+  @param &display - the display
+  @param code[] - the display's character codes of the frame's glyphs
+  @param startTime - when the update started in microseconds
+  @param budget - the time budget in microseconds, 0 for no limit
+  @returns true if all of the changed characters were sent
+  */
+  bool flush(const LiquidFrame &frame, LiquidDisplay &display,
+             const uint8_t code[], uint32_t startTime, uint32_t budget) const;
+
+  /// Counts the unchanged characters before the next changed one.
+  /**
+  @param &frame - the printed frame
+  @param &display - the display
+  @param code[] - the characters of the frame's glyph slots
+  @param row - the row
+  @param column - the column after the last changed character
+  @param columns - the count of columns that are written
+  @param maxGap - the most unchanged characters that are rewritten
+  @returns the count of unchanged characters, 0 if there are more than
+  `maxGap` or no changed character follows them
+  */
+  uint8_t measure_gap(const LiquidFrame &frame, const LiquidDisplay &display,
+                      const uint8_t code[], uint8_t row, uint8_t column,
+                      uint8_t columns, uint8_t maxGap) const;
+
+  /// Sends a frame to every display.
+  /**
+  The displays are sent their changes one after another, a display whose
+  changes don't fit in the time budget is continued by the next call.
+
+  @param &frame - the rendered frame
+  @param startTime - when the update started in microseconds
+  @param budget - the time budget in microseconds, 0 for no limit
+  @returns true if all of the changed characters were sent
+  */
+  bool flush_displays(const LiquidFrame &frame, uint32_t startTime,
+                      uint32_t budget) const;
+
+  /// Returns one of the displays.
+  /**
+  @param index - 0 for the menu's own display, the mirrors follow
+  @returns the display's state
+  */
+  LiquidDisplay& get_display(uint8_t index) const;
+
+  /// Returns the object the menu's own display is built for.
+  /**
+  @returns the DisplayClass object or the driver passed to the constructor
+  */
+  const void* get_target() const;
+
+  /// Adds the menu to the list of the menus.
+  /**
+  A menu built for the same object as an earlier one draws on the earlier
+  menu's display, so that they share what it shows.
+  */
+  void join_menus();
+
+  /// Prints the current screen and sends it to the display.
+  /**
+  @param startTime - when the update started in microseconds, used for
+  measuring the render duration
+  @param budget - the time budget in microseconds, 0 for no limit
+  @returns true if the whole screen was sent
+  */
+  bool render(uint32_t startTime, uint32_t budget) const;
+
+  /// Prints the current screen and sends the refreshed lines' regions.
+  /**
+  The refreshed lines are the ones marked as due.
+
+  @param variable - the first refreshed variable, 0 for the whole lines
+  */
+  void refresh(uint8_t variable) const;
+
+  /// Measures the render duration.
+  /**
+  @param startTime - when the rendering started in microseconds
+  */
+  void record_renderTime(uint32_t startTime) const;
+
+  /// Clears the displays and their shadow copies.
+  void clear_display() const;
+
+  /// Uploads the glyphs of a frame to a display.
+  /**
+  The glyphs already on the display are kept first, the missing ones are
+  uploaded to the free or least recently used slots.
+
+  @param &frame - the printed frame
+  @param &display - the display
+  @param code[] - receives the display's character code of every glyph
+  of the frame
+  */
+  void resolve_glyphs(const LiquidFrame &frame, LiquidDisplay &display,
+                      uint8_t code[]) const;
+
+  /// Uploads a glyph to a display's CGRAM.
+  /**
+  @param &display - the display
+  @param index - the glyph's index
+  @param glyph[] - the glyph
+  */
+  void upload_glyph(LiquidDisplay &display, uint8_t index, uint8_t glyph[8]) const;
+
+  /// Rebuilds the mask of the shown screens if a screen was hidden or shown.
+  void update_shownScreens();
+
+  /// Drives the `DisplayClass` object passed to the constructor
+  LiquidTypedDriver<DisplayClass> _ownDriver;
+  LiquidDisplay _display; ///< The menu's own display
+  /// The display drawn on, the own one or the one of an earlier menu built
+  /// for the same object
+  LiquidDisplay *_p_display;
+  LiquidMenuBase *_p_nextMenu; ///< The next menu in the list of the menus
+  LiquidDisplay *_p_mirror[MAX_MIRRORS]; ///< The displays mirroring the menu
+  uint8_t _mirrorCount; ///< Count of the mirroring displays
+  LiquidScreenBase **_p_liquidScreen; ///< The LiquidScreen objects
+  uint8_t _screenCapacity; ///< Maximum count of the LiquidScreen objects
+  uint8_t _screenCount; ///< Count of the LiquidScreen objects
+  uint8_t _currentScreen;
+  LiquidIndexMask _shownScreens; ///< The screens which aren't hidden
+  /// `LiquidScreenBase::_hiddenChanges` when the mask was built
+  uint16_t _hiddenSync;
+  bool _clearOnUpdate; ///< Clear the display on every update
+  bool _deferredUpdate; ///< Leave the updates to poll()
+  mutable bool _stale; ///< The display doesn't show the current screen
+  mutable bool _clearPending; ///< poll() has to clear the display first
+  mutable LiquidStats _stats; ///< The rendering statistics
+  uint8_t *_p_focusGlyph[3]; ///< The focus symbols, by `Position`
+  uint8_t _reservedGlyphs; ///< Bit mask of the slots reserved for the user
+  uint32_t _lastTick; ///< The time passed to the last `tick()`
+  bool _ticking; ///< False until the first `tick()` on the current screen
 };
 
 
 /// Represents a collection of screens forming a menu.
 /**
-A menu is made up of LiquidScreen objects. It holds pointers to them and
-calls their functions depending on which one is active. This is the class
-used for control. It is possible to use multiple menus, it that case this
-classes' objects go into a LiquidSystem object which controls them using
-the same public methods.
+Holds up to `MAX_SCREENS` screens.
 
-@see LiquidScreen
+@see LiquidMenuBase
+@see LiquidSizedMenu
 */
-class LiquidMenu {
-  friend class LiquidSystem;
-
+class LiquidMenu : public LiquidMenuBase {
 public:
 
   /// @name Constructors
@@ -818,7 +3074,7 @@ public:
   @param startingScreen - the number of the screen that will be shown
   first
   */
-  LiquidMenu(DisplayClass &liquidCrystal, LiquidScreen &liquidScreen,
+  LiquidMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen,
              uint8_t startingScreen = 1);
 
   /// Constructor for 2 LiquidScreen objects.
@@ -829,8 +3085,8 @@ public:
   @param startingScreen - the number of the screen that will be shown
   first
   */
-  LiquidMenu(DisplayClass &liquidCrystal, LiquidScreen &liquidScreen1,
-             LiquidScreen &liquidScreen2, uint8_t startingScreen = 1);
+  LiquidMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen1,
+             LiquidScreenBase &liquidScreen2, uint8_t startingScreen = 1);
 
   /// Constructor for 3 LiquidScreen objects.
   /**
@@ -841,8 +3097,8 @@ public:
   @param startingScreen - the number of the screen that will be shown
   first
   */
-  LiquidMenu(DisplayClass &liquidCrystal, LiquidScreen &liquidScreen1,
-             LiquidScreen &liquidScreen2, LiquidScreen &liquidScreen3,
+  LiquidMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen1,
+             LiquidScreenBase &liquidScreen2, LiquidScreenBase &liquidScreen3,
              uint8_t startingScreen = 1);
 
   /// Constructor for 4 LiquidScreen objects.
@@ -855,217 +3111,537 @@ public:
   @param startingScreen - the number of the screen that will be shown
   first
   */
-  LiquidMenu(DisplayClass &liquidCrystal, LiquidScreen &liquidScreen1,
-             LiquidScreen &liquidScreen2, LiquidScreen &liquidScreen3,
-             LiquidScreen &liquidScreen4, uint8_t startingScreen = 1);
+  LiquidMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen1,
+             LiquidScreenBase &liquidScreen2, LiquidScreenBase &liquidScreen3,
+             LiquidScreenBase &liquidScreen4, uint8_t startingScreen = 1);
 
-  ///@}
+  /// Constructor for a display of another type.
+  /**
+  @param &driver - the display's driver
+  @param startingScreen - the number of the screen that will be shown
+  first
 
-  /// @name Public methods
-  ///@{
+  @see make_liquidDriver
+  */
+  explicit LiquidMenu(LiquidDisplayDriver &driver, uint8_t startingScreen = 1);
 
-  /// Adds a LiquidScreen object to the menu.
+  /// Constructor for a display of another type and LiquidScreen objects.
   /**
-  @param &liquidScreen - pointer to a LiquidScreen object
-  @returns true on success and false if the maximum amount of screens
-  has been reached
-
-  @note The maximum amount of screens per menu is specified in
-  LiquidMenu_config.h as `MAX_SCREENS`. The default is 16.
+  The screen shown first is the first one.
 
-  @see LiquidMenu_config.h
-  @see MAX_SCREENS
+  @param &driver - the display's driver
+  @param &liquidScreen - the first screen
+  @param &liquidScreens - more screens
   */
-  bool add_screen(LiquidScreen &liquidScreen);
+  template <typename... Ss>
+  LiquidMenu(LiquidDisplayDriver &driver, LiquidScreenBase &liquidScreen,
+             Ss &... liquidScreens)
+    : LiquidMenu(driver) {
+    add_screens(liquidScreen, liquidScreens...);
+  }
 
-  /// Returns a reference to the current screen.
+  /// The copy constructor.
   /**
-  Call this method to obtain a reference to the current screen.
-
-  @returns a pointer to the current screen.
+  @param &other - the copied menu
   */
-  LiquidScreen* get_currentScreen() const;
+  LiquidMenu(const LiquidMenu &other);
 
-  /// Switches to the next screen.
-  void next_screen();
+  ///@}
+
+private:
+  /// Adds the screens passed to the constructor one by one.
+  void add_screens() {}
+
+  template <typename... Ss>
+  void add_screens(LiquidScreenBase &liquidScreen, Ss &... liquidScreens) {
+    add_screen(liquidScreen);
+    add_screens(liquidScreens...);
+  }
+
+  LiquidScreenBase *_liquidScreen[MAX_SCREENS]; ///< Storage for the screens
+  uint8_t _shownBits[(MAX_SCREENS + 7) / 8]; ///< Storage for the mask
+};
+
+
+/// Represents a menu holding up to `N` screens.
+/**
+Reserves exactly as much memory for the pointers to the screens as
+needed, instead of `MAX_SCREENS` for every menu. Create it directly or
+with `make_liquidMenu()`:
+
+~~~{.cpp}
+LiquidSizedMenu<2> settings_menu(lcd, brightness_screen, contrast_screen);
+auto main_menu = make_liquidMenu(lcd, welcome_screen, status_screen);
+~~~
+
+@tparam N - the maximum count of screens
 
-  /// Switches to the next screen.
+@see LiquidMenuBase
+@see make_liquidMenu
+*/
+template <uint8_t N>
+class LiquidSizedMenu : public LiquidMenuBase {
+  static_assert(N > 0, "LiquidSizedMenu needs room for at least one screen");
+
+public:
+  /// The main constructor.
   /**
-  @note Prefix increment operator overloading.
+  @param &liquidCrystal - pointer to the DisplayClass object
+  @param startingScreen - the number of the screen that will be shown
+  first
   */
-  void operator++();
+  explicit LiquidSizedMenu(DisplayClass &liquidCrystal, uint8_t startingScreen = 1)
+    : LiquidMenuBase(liquidCrystal, _liquidScreen, _shownBits, N, startingScreen) {}
 
-  /// Switches to the next screen.
+  /// Constructor for one or more LiquidScreen objects.
   /**
-  @note Postfix increment operator overloading.
-  */
-  void operator++(int);
+  The screen shown first is the first one.
 
-  /// Switches to the previous screen.
-  void previous_screen();
+  @param &liquidCrystal - pointer to the DisplayClass object
+  @param &liquidScreen - the first screen
+  @param &liquidScreens - more screens
+  */
+  template <typename... Ss>
+  LiquidSizedMenu(DisplayClass &liquidCrystal, LiquidScreenBase &liquidScreen,
+                  Ss &... liquidScreens)
+    : LiquidSizedMenu(liquidCrystal) {
+    static_assert(sizeof...(Ss) < N, "Too many screens for the LiquidSizedMenu");
+    add_screens(liquidScreen, liquidScreens...);
+  }
 
-  /// Switches to the previous screen.
+  /// Constructor for a display of another type.
   /**
-  @note Prefix decrement operator overloading.
-  */
-  void operator--();
+  @param &driver - the display's driver
+  @param startingScreen - the number of the screen that will be shown
+  first
 
-  /// Switches to the previous screen.
-  /**
-  @note Postfix decrement operator overloading.
+  @see make_liquidDriver
   */
-  void operator--(int);
+  explicit LiquidSizedMenu(LiquidDisplayDriver &driver, uint8_t startingScreen = 1)
+    : LiquidMenuBase(driver, _liquidScreen, _shownBits, N, startingScreen) {}
 
-  /// Switches to the specified screen.
+  /// Constructor for a display of another type and LiquidScreen objects.
   /**
-  @param *p_liquidScreen - pointer to the LiquidScreen object
-  @returns true on success and false if the screen is not found
-  */
-  bool change_screen(LiquidScreen *p_liquidScreen);
+  The screen shown first is the first one.
 
-  /// Switches to the specified screen.
-  /**
-  @param number - the number of the screen
-  @returns true on success and false if the
-  number of the screen is invalid.
+  @param &driver - the display's driver
+  @param &liquidScreen - the first screen
+  @param &liquidScreens - more screens
   */
-  bool change_screen(uint8_t number);
+  template <typename... Ss>
+  LiquidSizedMenu(LiquidDisplayDriver &driver, LiquidScreenBase &liquidScreen,
+                  Ss &... liquidScreens)
+    : LiquidSizedMenu(driver) {
+    static_assert(sizeof...(Ss) < N, "Too many screens for the LiquidSizedMenu");
+    add_screens(liquidScreen, liquidScreens...);
+  }
 
-  /// Switches to the specified screen.
+  /// The copy constructor.
   /**
-  @param &p_liquidScreen - pointer to the screen
-  @returns true on success and false if the screen is not found
+  @param &other - the copied menu
   */
-  bool operator=(LiquidScreen *p_liquidScreen);
+  LiquidSizedMenu(const LiquidSizedMenu &other)
+    : LiquidMenuBase(other, _liquidScreen, _shownBits) {}
 
-  /// Switches to the specified screen.
-  /**
-  @param number - the number of the screen
-  @returns true on success and false if the
-  number of the screen is invalid.
-  */
-  bool operator=(uint8_t number);
+private:
+  /// Adds the screens passed to the constructor one by one.
+  void add_screens() {}
 
-  /// Switches the focus
-  /**
-  Switches the focus to the next or previous line
-  according to the passed parameter.
+  template <typename... Ss>
+  void add_screens(LiquidScreenBase &liquidScreen, Ss &... liquidScreens) {
+    add_screen(liquidScreen);
+    add_screens(liquidScreens...);
+  }
 
-  @note Only lines that have had a function attached via
-  `LiquidLine::attach_function()` are focusable. If no line on the
-  current screen is focusable, the focus indicator stays hidden and
-  this call has no visible effect.
+  LiquidScreenBase *_liquidScreen[N]; ///< Storage for the screens
+  uint8_t _shownBits[(N + 7) / 8]; ///< Storage for the mask
+};
 
-  @param forward - true for forward, false for backward
-  */
-  void switch_focus(bool forward = true);
-  
-  /// Directly select focused line.
-  /**
-  @note A line only becomes focusable after `LiquidLine::attach_function()`
-  has been called on it, even with a no-op function used purely to
-  enable focus (see `examples/F_focus_menu`).
+/// Creates a LiquidSizedMenu with room for exactly the passed screens.
+/**
+@param &liquidCrystal - pointer to the DisplayClass object
+@param &liquidScreens - the screens of the menu
+@returns the menu holding the screens
+*/
+template <typename... Ss>
+LiquidSizedMenu<sizeof...(Ss)> make_liquidMenu(DisplayClass &liquidCrystal,
+                                               Ss &... liquidScreens) {
+  return LiquidSizedMenu<sizeof...(Ss)>(liquidCrystal, liquidScreens...);
+}
 
-  @param lineIndex - index of the focused line
-  @return true: on success, false: when the selected line doesn't exist or it isn't focusable
-  */
-  bool set_focusedLine(uint8_t lineIndex);
+/// Creates a LiquidSizedMenu for a display of another type.
+/**
+@param &driver - the display's driver
+@param &liquidScreens - the screens of the menu
+@returns the menu holding the screens
+*/
+template <typename... Ss>
+LiquidSizedMenu<sizeof...(Ss)> make_liquidMenu(LiquidDisplayDriver &driver,
+                                               Ss &... liquidScreens) {
+  return LiquidSizedMenu<sizeof...(Ss)>(driver, liquidScreens...);
+}
 
-  /// Get the index of the currently focused line.
+
+/// A variable of a line defined in flash memory.
+/**
+Holds a pointer to the variable and its data type which is recognized at
+compile time, so the definitions can be `constexpr` and kept in flash
+memory. The supported types are the same as for LiquidLine, glyphs and
+strings in flash memory are passed through `as_glyph()` and
+`as_progmem()`. Constant text is declared `PROGMEM` too, a string literal
+or a `const char[]` would be kept in RAM and isn't accepted:
+
+~~~{.cpp}
+const char temp_text[] PROGMEM = "Temp: ";
+const char celsius_text[] PROGMEM = "C";
+constexpr LiquidVariableDef status_variables[] PROGMEM = {
+  as_progmem(temp_text), temperature, as_progmem(celsius_text)
+};
+~~~
+
+@see LiquidLineDef
+*/
+struct LiquidVariableDef {
+  /// @name Constructors
+  ///@{
+  LiquidVariableDef() = default;
+  constexpr LiquidVariableDef(const bool &variable)
+    : p_variable(&variable), type(DataType::BOOL) {}
+  constexpr LiquidVariableDef(const char &variable)
+    : p_variable(&variable), type(DataType::CHAR) {}
+  constexpr LiquidVariableDef(const int8_t &variable)
+    : p_variable(&variable), type(DataType::INT8_T) {}
+  constexpr LiquidVariableDef(const uint8_t &variable)
+    : p_variable(&variable), type(DataType::UINT8_T) {}
+  constexpr LiquidVariableDef(const int16_t &variable)
+    : p_variable(&variable), type(DataType::INT16_T) {}
+  constexpr LiquidVariableDef(const uint16_t &variable)
+    : p_variable(&variable), type(DataType::UINT16_T) {}
+  constexpr LiquidVariableDef(const int32_t &variable)
+    : p_variable(&variable), type(DataType::INT32_T) {}
+  constexpr LiquidVariableDef(const uint32_t &variable)
+    : p_variable(&variable), type(DataType::UINT32_T) {}
+  constexpr LiquidVariableDef(const float &variable)
+    : p_variable(&variable), type(DataType::FLOAT) {}
+  constexpr LiquidVariableDef(const double &variable)
+    : p_variable(&variable), type(DataType::DOUBLE) {}
+  template <uint8_t N>
+  constexpr LiquidVariableDef(char (&text)[N])
+    : p_variable(text), type(DataType::CHAR_PTR) {}
+  /// Rejects the constant strings, they would be kept in RAM.
+  template <uint8_t N>
+  LiquidVariableDef(const char (&text)[N]) : p_variable(text) {
+    static_assert(N == 0, "A string in a LiquidVariableDef is kept in RAM, "
+                  "declare it PROGMEM and pass it through as_progmem()");
+  }
+  constexpr LiquidVariableDef(uint8_t (&bitmap)[8])
+    : p_variable(bitmap), type(DataType::GLYPH_BITMAP) {}
+  constexpr LiquidVariableDef(LiquidGlyph glyph)
+    : p_variable(glyph.p_index), type(DataType::GLYPH) {}
+  constexpr LiquidVariableDef(LiquidGlyphBitmap glyph)
+    : p_variable(glyph.p_bitmap), type(DataType::GLYPH_BITMAP) {}
+  constexpr LiquidVariableDef(LiquidProgmem progmem)
+    : p_variable(progmem.text), type(DataType::PROG_CONST_CHAR_PTR) {}
+  constexpr LiquidVariableDef(boolFnPtr getter)
+    : boolGetter(getter), type(DataType::BOOL_GETTER) {}
+  constexpr LiquidVariableDef(int8tFnPtr getter)
+    : int8tGetter(getter), type(DataType::INT8_T_GETTER) {}
+  constexpr LiquidVariableDef(uint8tFnPtr getter)
+    : uint8tGetter(getter), type(DataType::UINT8_T_GETTER) {}
+  constexpr LiquidVariableDef(int16tFnPtr getter)
+    : int16tGetter(getter), type(DataType::INT16_T_GETTER) {}
+  constexpr LiquidVariableDef(uint16tFnPtr getter)
+    : uint16tGetter(getter), type(DataType::UINT16_T_GETTER) {}
+  constexpr LiquidVariableDef(int32tFnPtr getter)
+    : int32tGetter(getter), type(DataType::INT32_T_GETTER) {}
+  constexpr LiquidVariableDef(uint32tFnPtr getter)
+    : uint32tGetter(getter), type(DataType::UINT32_T_GETTER) {}
+  constexpr LiquidVariableDef(floatFnPtr getter)
+    : floatGetter(getter), type(DataType::FLOAT_GETTER) {}
+  constexpr LiquidVariableDef(doubleFnPtr getter)
+    : doubleGetter(getter), type(DataType::DOUBLE_GETTER) {}
+  constexpr LiquidVariableDef(charFnPtr getter)
+    : charGetter(getter), type(DataType::CHAR_GETTER) {}
+  constexpr LiquidVariableDef(charPtrFnPtr getter)
+    : charPtrGetter(getter), type(DataType::CHAR_PTR_GETTER) {}
+  constexpr LiquidVariableDef(constcharPtrFnPtr getter)
+    : constcharPtrGetter(getter), type(DataType::CONST_CHAR_PTR_GETTER) {}
+  ///@}
+
+  /// The variable or the getter function, read through `p_variable`.
+  union {
+    const void *p_variable; ///< Pointer to the variable
+    boolFnPtr boolGetter;
+    int8tFnPtr int8tGetter;
+    uint8tFnPtr uint8tGetter;
+    int16tFnPtr int16tGetter;
+    uint16tFnPtr uint16tGetter;
+    int32tFnPtr int32tGetter;
+    uint32tFnPtr uint32tGetter;
+    floatFnPtr floatGetter;
+    doubleFnPtr doubleGetter;
+    charFnPtr charGetter;
+    charPtrFnPtr charPtrGetter;
+    constcharPtrFnPtr constcharPtrGetter;
+  };
+  DataType type; ///< The data type of the variable
+};
+
+/// A function of a line defined in flash memory.
+/**
+@see LiquidLineDef
+*/
+struct LiquidFunctionDef {
+  uint8_t number; ///< Function number used for identification
+  void (*function)(void); ///< Pointer to the function
+};
+
+/// A line defined in flash memory.
+/**
+Create the definitions with `make_liquidLineDef()`, they point to the
+arrays of their variables and functions.
+
+@see LiquidFlashScreen
+*/
+struct LiquidLineDef {
+  uint8_t column; ///< The column at which the line starts
+  uint8_t row; ///< The row at which the line is printed
+  const LiquidVariableDef *p_variables; ///< The variables in flash memory
+  uint8_t variableCount; ///< Count of the variables
+  const LiquidFunctionDef *p_functions; ///< The functions in flash memory
+  uint8_t functionCount; ///< Count of the functions
+  Position focusPosition; ///< Position of the focus indicator
+  uint8_t focusColumn; ///< The column of a `CUSTOM` focus indicator
+  uint8_t focusRow; ///< The row of a `CUSTOM` focus indicator
+  uint8_t decimalPlaces; ///< Decimal places of floating point numbers
+};
+
+/// Creates the definition of a line without functions.
+/**
+@param column - the column at which the line starts
+@param row - the row at which the line is printed
+@param &variables - the variables' definitions in flash memory
+@param decimalPlaces - decimal places of floating point numbers
+@returns the line's definition
+*/
+template <uint8_t V>
+constexpr LiquidLineDef make_liquidLineDef(uint8_t column, uint8_t row,
+                                           const LiquidVariableDef (&variables)[V],
+                                           uint8_t decimalPlaces = 2) {
+  return LiquidLineDef{ column, row, variables, V, nullptr, 0,
+                        Position::NORMAL, 0, 0, decimalPlaces };
+}
+
+/// Creates the definition of a line with functions.
+/**
+The line is focusable.
+
+@param column - the column at which the line starts
+@param row - the row at which the line is printed
+@param &variables - the variables' definitions in flash memory
+@param &functions - the functions' definitions in flash memory
+@param focusPosition - `LEFT` or `RIGHT`
+@param decimalPlaces - decimal places of floating point numbers
+@returns the line's definition
+*/
+template <uint8_t V, uint8_t F>
+constexpr LiquidLineDef make_liquidLineDef(uint8_t column, uint8_t row,
+                                           const LiquidVariableDef (&variables)[V],
+                                           const LiquidFunctionDef (&functions)[F],
+                                           Position focusPosition = Position::NORMAL,
+                                           uint8_t decimalPlaces = 2) {
+  return LiquidLineDef{ column, row, variables, V, functions, F,
+                        focusPosition, 0, 0, decimalPlaces };
+}
+
+/// A screen defined in flash memory.
+/**
+@see LiquidFlashMenu
+*/
+struct LiquidScreenDef {
+  const LiquidLineDef *p_lines; ///< The lines in flash memory
+  uint8_t lineCount; ///< Count of the lines
+};
+
+/// Creates the definition of a screen.
+/**
+@param &lines - the lines' definitions in flash memory
+@returns the screen's definition
+*/
+template <uint8_t L>
+constexpr LiquidScreenDef make_liquidScreenDef(const LiquidLineDef (&lines)[L]) {
+  static_assert(L <= MAX_LINES, "Too many lines for a LiquidFlashScreen");
+  return LiquidScreenDef{ lines, L };
+}
+
+
+/// Represents a screen whose lines are defined in flash memory.
+/**
+The lines take no RAM, only the state of the screen (focus, hidden,
+scrolling) is kept in RAM. The lines are loaded from flash memory one at
+a time when they are printed or focused. The structure of the screen is
+fixed, lines can't be added. A screen holds up to `MAX_LINES` lines.
+The lines don't have refresh periods, `LiquidMenu::tick()` never redraws
+them.
+
+~~~{.cpp}
+const char temp_text[] PROGMEM = "Temp: ";
+constexpr LiquidVariableDef temperature_variables[] PROGMEM = {
+  as_progmem(temp_text), temperature
+};
+constexpr LiquidFunctionDef temperature_functions[] PROGMEM = {
+  {1, increase_setpoint}, {2, decrease_setpoint}
+};
+constexpr LiquidLineDef status_lines[] PROGMEM = {
+  make_liquidLineDef(0, 0, temperature_variables, temperature_functions),
+  make_liquidLineDef(0, 1, humidity_variables),
+};
+LiquidFlashScreen status_screen(status_lines);
+~~~
+
+@see LiquidLineDef
+@see LiquidFlashMenu
+*/
+class LiquidFlashScreen : public LiquidScreenBase {
+public:
+  /// @name Constructors
+  ///@{
+
+  /// The main constructor, the screen has no lines until loaded.
+  LiquidFlashScreen();
+
+  /// Constructor for the lines' definitions in flash memory.
   /**
-  @returns the index of the currently focused line
+  @param &lines - the lines' definitions in flash memory
   */
-  uint8_t get_focusedLine() const;
+  template <uint8_t L>
+  explicit LiquidFlashScreen(const LiquidLineDef (&lines)[L])
+    : LiquidFlashScreen() {
+    static_assert(L <= MAX_LINES, "Too many lines for a LiquidFlashScreen");
+    load(lines, L);
+  }
 
-  /// Sets the focus position for the whole menu at once.
+  /// The copy constructor.
   /**
-  The valid positions are `LEFT` and `RIGHT`. `CUSTOM` is not valid
-  for this function because it needs individual column and row for
-  every line.
+  @param &other - the copied screen
+  */
+  LiquidFlashScreen(const LiquidFlashScreen &other);
 
-  @param position - `LEFT` or `RIGHT`
-  @returns true on success and false if the position specified is
-  invalid
+  ///@}
 
-  @note The `Position` is enum class. Use `Position::(member)` when
-  specifying the position.
+  /// @name Public methods
+  ///@{
 
-  @see Position
+  /// Loads the screen from its definition in flash memory.
+  /**
+  @param *p_definition - the screen's definition in flash memory
   */
-  bool set_focusPosition(Position position);
+  void load(const LiquidScreenDef *p_definition);
 
-  /// Changes the focus indicator's symbol.
+  /// Sets the focus position for all lines of the screen.
   /**
-  The symbol is changed for a particular position.
+  Overrides the positions in the lines' definitions.
 
-  @param position - the position for which the symbol will be changed
-  @param symbol[] - the symbol
+  @param position - `LEFT` or `RIGHT`
   @returns true on success and false if the position specified is
   invalid
+  */
+  virtual bool set_focusPosition(Position position);
+  ///@}
 
-  @note The `Position` is enum class. Use `Position::(member)` when
-  specifying the position.
-
-  @see Position
+private:
+  /// Loads the screen from the lines' definitions.
+  /**
+  @param *p_lines - the lines' definitions in flash memory
+  @param lineCount - count of the lines
   */
-  bool set_focusSymbol(Position position, uint8_t symbol[8]);
+  void load(const LiquidLineDef *p_lines, uint8_t lineCount);
 
-  /// Check if there is an attached function at the specified number.
+  /// Loads a line from flash memory.
   /**
-  @param number - number of the function in the array
-  @returns true if there is a function at the specified number
+  @param index - index of the line
+  @returns pointer to the loaded line, valid until the next line is loaded
+  */
+  virtual LiquidLineBase* get_line(uint8_t index) const;
 
-  @note Function numbering starts from 1.
+  const LiquidLineDef *_p_lines; ///< The lines in flash memory
+  uint8_t _focusPosition; ///< Focus position of all lines, 0 for as defined
+  uint8_t _focusableBits[(MAX_LINES + 7) / 8]; ///< Storage for the mask
+};
 
-  @see bool LiquidLine::attach_function(uint8_t number, void (*function)(void))
-  */
-  bool is_callable(uint8_t number) const;
 
-  /// Calls an attached function specified by the number.
-  /**
-  Calls the function specified by the number argument for the current
-  screen and for the focused line.
+/// Represents a menu whose screens are defined in flash memory.
+/**
+Keeps only the state of the `N` screens in RAM:
 
-  @param number - number of the function in the array
-  @param refresh - enable/disable updating the display
-  @returns true if there is a function at the specified number
+~~~{.cpp}
+constexpr LiquidScreenDef menu_screens[] PROGMEM = {
+  make_liquidScreenDef(welcome_lines),
+  make_liquidScreenDef(status_lines),
+};
+LiquidFlashMenu<2> menu(lcd, menu_screens);
+~~~
 
-  @note Function numbering starts from 1.
+@tparam N - the count of screens
 
-  @see bool LiquidLine::attach_function(uint8_t number, void (*function)(void))
+@see LiquidFlashScreen
+@see LiquidScreenDef
+*/
+template <uint8_t N>
+class LiquidFlashMenu : public LiquidMenuBase {
+public:
+  /// The main constructor.
+  /**
+  @param &liquidCrystal - pointer to the DisplayClass object
+  @param &screens - the screens' definitions in flash memory
+  @param startingScreen - the number of the screen that will be shown
+  first
   */
-  bool call_function(uint8_t number, bool refresh = true) const;
+  LiquidFlashMenu(DisplayClass &liquidCrystal, const LiquidScreenDef (&screens)[N],
+                  uint8_t startingScreen = 1)
+    : LiquidMenuBase(liquidCrystal, _p_screen, _shownBits, N, startingScreen) {
+    load_screens(screens);
+  }
 
-  /// Prints the current screen to the display.
+  /// Constructor for a display of another type.
   /**
-  Call this method when there is a change in some of the attached variables.
+  @param &driver - the display's driver
+  @param &screens - the screens' definitions in flash memory
+  @param startingScreen - the number of the screen that will be shown
+  first
   */
-  void update() const;
+  LiquidFlashMenu(LiquidDisplayDriver &driver, const LiquidScreenDef (&screens)[N],
+                  uint8_t startingScreen = 1)
+    : LiquidMenuBase(driver, _p_screen, _shownBits, N, startingScreen) {
+    load_screens(screens);
+  }
 
-  /// Prints the current screen to the display (without clearing).
+  /// Returns a screen of the menu.
   /**
-  Call this method when there is a change in some of the variable attached
-  and the new symbols cover all of the old symbols.
-
-  @note This method doesn't clear the display.
+  @param number - the number of the screen, starting from 1
+  @returns pointer to the screen, e.g. for hiding it
   */
-  void softUpdate() const;
+  LiquidFlashScreen* get_screen(uint8_t number) {
+    return ((number > 0) && (number <= N)) ? &_screen[number - 1] : nullptr;
+  }
 
-  /// Initializes the menu object.
-  /**
-  Call this method to fully initialize the menu object.
+private:
+  LiquidFlashMenu(const LiquidFlashMenu &other) = delete;
 
-  @note Needed when using an I2C display library.
+  /// Loads the screens from their definitions and adds them.
+  /**
+  @param &screens - the screens' definitions in flash memory
   */
-  void init() const;
-
-  ///@}
+  void load_screens(const LiquidScreenDef (&screens)[N]) {
+    for (uint8_t s = 0; s < N; s++) {
+      _screen[s].load(&screens[s]);
+      add_screen(_screen[s]);
+    }
+  }
 
-private:
-  DisplayClass *_p_liquidCrystal; ///< Pointer to the DisplayClass object
-  LiquidScreen *_p_liquidScreen[MAX_SCREENS]; ///< The LiquidScreen objects
-  uint8_t _screenCount; ///< Count of the LiquidScreen objects
-  uint8_t _currentScreen;
+  LiquidFlashScreen _screen[N]; ///< The state of the screens
+  LiquidScreenBase *_p_screen[N]; ///< Pointers to the screens
+  uint8_t _shownBits[(N + 7) / 8]; ///< Storage for the mask
 };
 
 
@@ -1100,7 +3676,7 @@ public:
   @param &liquidMenu2 - pointer to a LiquidMenu object
   @param startingMenu - the number of the menu that will be shown first
   */
-  LiquidSystem(LiquidMenu &liquidMenu1, LiquidMenu &liquidMenu2,
+  LiquidSystem(LiquidMenuBase &liquidMenu1, LiquidMenuBase &liquidMenu2,
                uint8_t startingMenu = 1);
 
   /// Constructor for 3 LiquidMenu objects.
@@ -1110,8 +3686,8 @@ public:
   @param &liquidMenu3 - pointer to a LiquidMenu object
   @param startingMenu - the number of the menu that will be shown first
   */
-  LiquidSystem(LiquidMenu &liquidMenu1, LiquidMenu &liquidMenu2,
-               LiquidMenu &liquidMenu3, uint8_t startingMenu = 1);
+  LiquidSystem(LiquidMenuBase &liquidMenu1, LiquidMenuBase &liquidMenu2,
+               LiquidMenuBase &liquidMenu3, uint8_t startingMenu = 1);
 
   /// Constructor for 4 LiquidMenu objects.
   /**
@@ -1121,8 +3697,8 @@ public:
   @param &liquidMenu4 - pointer to a LiquidMenu object
   @param startingMenu - the number of the menu that will be shown first
   */
-  LiquidSystem(LiquidMenu &liquidMenu1, LiquidMenu &liquidMenu2,
-               LiquidMenu &liquidMenu3, LiquidMenu &liquidMenu4,
+  LiquidSystem(LiquidMenuBase &liquidMenu1, LiquidMenuBase &liquidMenu2,
+               LiquidMenuBase &liquidMenu3, LiquidMenuBase &liquidMenu4,
                uint8_t startingMenu = 1);
 
   ///@}
@@ -1142,14 +3718,14 @@ public:
   @see LiquidMenu_config.h
   @see MAX_MENUS
   */
-  bool add_menu(LiquidMenu &liquidMenu);
+  bool add_menu(LiquidMenuBase &liquidMenu);
 
   /// Switches to the specified menu.
   /**
   @param *p_liquidMenu - pointer to the LiquidMenu object
   @returns true on success and false if the menu is not found
   */
-  bool change_menu(LiquidMenu &p_liquidMenu);
+  bool change_menu(LiquidMenuBase &p_liquidMenu);
 
   /// Returns a reference to the current screen.
   /**
@@ -1157,7 +3733,7 @@ public:
 
   @returns a pointer to the current screen.
   */
-  LiquidScreen* get_currentScreen() const;
+  LiquidScreenBase* get_currentScreen() const;
 
   /// Returns a pointer to the current menu.
   /**
@@ -1165,7 +3741,7 @@ public:
 
   @returns a pointer to the current menu.
   */
-  LiquidMenu* get_currentMenu() const;
+  LiquidMenuBase* get_currentMenu() const;
 
   /// Switches to the next screen.
   void next_screen();
@@ -1202,7 +3778,7 @@ public:
   @param *p_liquidScreen - pointer to the LiquidScreen object
   @returns true on success and false if the screen is not found
   */
-  bool change_screen(LiquidScreen *p_liquidScreen);
+  bool change_screen(LiquidScreenBase *p_liquidScreen);
 
   /// Switches to the specified screen.
   /**
@@ -1217,7 +3793,7 @@ public:
   @param &p_liquidScreen - pointer to the screen
   @returns true on success and false if the screen is not found
   */
-  bool operator=(LiquidScreen *p_liquidScreen);
+  bool operator=(LiquidScreenBase *p_liquidScreen);
 
   /// Switches to the specified screen.
   /**
@@ -1287,10 +3863,28 @@ public:
   @note The `Position` is enum class. Use `Position::(member)` when
   specifying the position.
 
+  @note The symbol isn't copied, it's uploaded to the display when the
+  focus indicator is shown. The array must not be a local variable.
+
   @see Position
   */
   bool set_focusSymbol(Position position, uint8_t symbol[8]);
 
+  /// Reserves a glyph slot for a glyph created by the user.
+  /**
+  The menu uploads the glyphs of the lines and the focus indicator to the
+  free or least recently used slots of the display's CGRAM. Reserve the
+  slots of the glyphs created with `createChar()` so that they aren't
+  replaced before a line printing them by index is shown.
+
+  @param index - the glyph's index (0 - 7)
+  @returns true on success and false if the index is invalid
+
+  @see LiquidLine::set_asGlyph(uint8_t number)
+  @see LiquidGlyphSlots
+  */
+  bool reserve_glyphSlot(uint8_t index);
+
   /// Check if there is an attached function at the specified number.
   /**
   @param number - number of the function in the array
@@ -1317,6 +3911,65 @@ public:
   */
   bool call_function(uint8_t number, bool refresh = true) const;
 
+  /// Enables/disables clearing the display on every update.
+  /**
+  Applies `LiquidMenu::set_clearOnUpdate(bool clear)` to all of the menus.
+
+  @param clear - true for clearing (default) and false for overwriting
+
+  @see LiquidMenu::set_clearOnUpdate(bool clear)
+  */
+  void set_clearOnUpdate(bool clear);
+
+  /// Sets the size of the menus' HD44780 displays.
+  /**
+  Applies `LiquidMenu::set_displaySize()` to all of the menus.
+
+  @param columns - the count of columns of the displays
+  @param rows - the count of rows of the displays (1 - 4)
+  @returns true on success and false if the displays are larger than the
+  frame (`MAX_COLUMNS`, `MAX_ROWS`)
+
+  @see LiquidMenu::set_displaySize()
+  */
+  bool set_displaySize(uint8_t columns, uint8_t rows);
+
+  /// Enables/disables deferring the updates to `poll()`.
+  /**
+  Applies `LiquidMenu::set_deferredUpdate(bool deferred)` to all of the
+  menus.
+
+  @param deferred - true for deferring and false for updating immediately
+  (default)
+
+  @see LiquidMenu::set_deferredUpdate(bool deferred)
+  */
+  void set_deferredUpdate(bool deferred);
+
+  /// Sends the pending changes to the display within a time budget.
+  /**
+  @param budgetUs - the time budget in microseconds, 0 for no limit
+  @returns true if the display is up to date and false if there are
+  pending changes left
+
+  @see LiquidMenu::poll(uint32_t budgetUs)
+  */
+  bool poll(uint32_t budgetUs);
+
+  /// Returns the rendering statistics of all of the menus.
+  /**
+  The counters and the longest render duration are combined from all of
+  the menus, the last render duration is the current menu's.
+
+  @returns the combined statistics
+
+  @see LiquidMenu::get_stats()
+  */
+  LiquidStats get_stats() const;
+
+  /// Sets the rendering statistics of all of the menus to zero.
+  void reset_stats();
+
   /// Prints the current screen to the display.
   /**
   Call this method when there is a change in some of the variable attached.
@@ -1332,10 +3985,44 @@ public:
   */
   void softUpdate() const;
 
+  /// Prints a single line of the current menu to the display.
+  /**
+  @param &liquidLine - the changed line
+
+  @see LiquidMenu::refresh_line(LiquidLineBase &liquidLine)
+  */
+  void refresh_line(LiquidLineBase &liquidLine) const;
+
+  /// Prints a single variable of a line of the current menu to the display.
+  /**
+  @param &liquidLine - the line holding the changed variable
+  @param number - the number of the variable, starting from 1
+
+  @see LiquidMenu::refresh_variable(LiquidLineBase &liquidLine, uint8_t number)
+  */
+  void refresh_variable(LiquidLineBase &liquidLine, uint8_t number) const;
+
+  /// Redraws the due lines of the current menu.
+  /**
+  @param now - the current time in milliseconds, usually `millis()`
+  @returns the time when the next redraw is due
+
+  @see LiquidMenu::tick(uint32_t now)
+  */
+  uint32_t tick(uint32_t now);
+
+  /// Redraws the lines of the current menu whose getters returned new values.
+  /**
+  @returns true if any line was redrawn
+
+  @see LiquidMenu::refresh_getters()
+  */
+  bool refresh_getters() const;
+
   ///@}
 
 private:
-  LiquidMenu *_p_liquidMenu[MAX_MENUS]; ///< The LiquidMenu objects
+  LiquidMenuBase *_p_liquidMenu[MAX_MENUS]; ///< The LiquidMenu objects
   uint8_t _menuCount; ///< Count of the LiquidMenu objects
   uint8_t _currentMenu;
 };
@@ -4,6 +4,10 @@ Configuration file for LiquidMenu library.
 
 Contains global constants the configure the size of some of the arrays
 used in the library, also configures the debugging messages.
+
+The `MAX_COLUMNS` and `MAX_ROWS` constants must be at least as big as the
+display that is used, content outside of them is not shown.
+`LiquidMenu::set_displaySize()` returns false for a larger display.
 */
 
 #pragma once
@@ -15,6 +19,9 @@ used in the library, also configures the debugging messages.
 
 /*!
  * @name Select a "LiquidCrystal" library
+ * The menus created with a display object expect it to be a `DisplayClass`.
+ * Displays of other classes are used together with it through a
+ * `LiquidTypedDriver` (`make_liquidDriver()`), without changing this file.
  * @{
  */
 
@@ -43,6 +50,32 @@ used in the library, also configures the debugging messages.
 // #endif
 //!@}
 
+/*!
+ * @name The library's own I2C backend for PCF8574 modules
+ * @see LiquidPCF8574
+ * @{
+ */
+// #ifndef LIQUIDMENU_LIBRARY
+//     #define LIQUIDMENU_LIBRARY LiquidPCF8574_LIBRARY
+// #endif
+// #ifndef DisplayClass
+//     #define DisplayClass LiquidPCF8574
+// #endif
+//!@}
+
+/*!
+ * @name The library's own parallel backend
+ * @see LiquidParallel
+ * @{
+ */
+// #ifndef LIQUIDMENU_LIBRARY
+//     #define LIQUIDMENU_LIBRARY LiquidParallel_LIBRARY
+// #endif
+// #ifndef DisplayClass
+//     #define DisplayClass LiquidParallel
+// #endif
+//!@}
+
 /*!
  * @name Some other library
  * @{
@@ -63,6 +96,28 @@ const uint8_t MAX_VARIABLES = 5; ///< @note Default: 5
 /// Configures the number of available functions per line.
 const uint8_t MAX_FUNCTIONS = 8; ///< @note Default: 8
 
+/// Configures the number of variables and functions of all lines together.
+/**
+Every variable of a LiquidLine (text included), every attached function
+and every refresh period takes a slot of 5 bytes on AVR, they are
+released when the line is destroyed. Count them for the lines of the
+sketch or check `LiquidLineBase::get_freeSlots()` and
+`LiquidLineBase::get_missingSlots()` in `setup()`. The lines made with
+`make_liquidLine()` use slots only for their functions and refresh
+periods. The default leaves room over the largest example (33 slots).
+*/
+const uint8_t MAX_LINE_SLOTS = 48; ///< @note Default: 48
+
+/// Configures the number of getter functions whose last value is kept.
+/**
+Every getter takes a cache of 11 bytes on AVR when it's added to a line,
+it's shared by all of the lines printing the getter. The getters that
+didn't get one are called on every update and always redrawn by
+`refresh_getters()`. Check `LiquidLine::get_missingGetterCaches()` in
+`setup()`.
+*/
+const uint8_t MAX_GETTER_CACHES = 8; ///< @note Default: 8
+
 /// Configures the number of available lines per screen.
 const uint8_t MAX_LINES = 12; ///< @note Default: 12
 
@@ -72,6 +127,19 @@ const uint8_t MAX_SCREENS = 14; ///< @note Default: 14
 /// Configures the number of available menus per menus system.
 const uint8_t MAX_MENUS = 8; ///< @note Default: 8
 
+/// Configures the number of displays mirroring a menu besides its own.
+const uint8_t MAX_MIRRORS = 1; ///< @note Default: 1
+
+/// Configures the number of columns kept in the display's framebuffer.
+/**
+Raise it to 40 for a 40x2 display, the frame and every display take
+`MAX_ROWS` more bytes per column.
+*/
+const uint8_t MAX_COLUMNS = 20; ///< @note Default: 20
+
+/// Configures the number of rows kept in the display's framebuffer.
+const uint8_t MAX_ROWS = 4; ///< @note Default: 4
+
 /*!
  * Enable/disable hiding the focus indicator.
  * 
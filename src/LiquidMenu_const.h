@@ -15,4 +15,22 @@ Constants file for LiquidMenu library.
 
 /// https://github.com/johnrickman/LiquidCrystal_I2C library (I2C)
 #define LiquidCrystal_I2C_LIBRARY (2)
+
+/// The library's own PCF8574 backend, LiquidPCF8574 (I2C)
+#define LiquidPCF8574_LIBRARY (3)
+
+/// The library's own parallel backend, LiquidParallel (parallel)
+#define LiquidParallel_LIBRARY (4)
 //!@}
+
+/// The number of custom characters (glyphs) the display can hold.
+const uint8_t GLYPH_SLOTS = 8;
+
+/// The handle of no line slot, ends the lists of slots.
+const uint8_t NO_SLOT = 0xFF;
+
+/// The index of no item of a LiquidListScreen.
+const uint16_t NO_ITEM = 0xFFFF;
+
+/// The position of a cursor which isn't known.
+const uint16_t NO_CURSOR = 0xFFFF;
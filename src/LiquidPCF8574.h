@@ -0,0 +1,391 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Vasil Kalchev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/**
+@file
+Contains the LiquidPCF8574 class definition.
+
+The class is defined in this header, so only the programs which include
+it depend on the `Wire` library.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <Print.h>
+#include <Wire.h>
+
+
+/// Drives an HD44780 display through a PCF8574 I2C backpack.
+/**
+A replacement for the `LiquidCrystal_I2C` library which sends runs of
+characters in bursts. Every byte written to the PCF8574 sets its outputs,
+so a nibble is latched with two bytes (enable high, enable low) and a
+character with four. As many characters as fit in the `Wire` buffer are
+sent in one transmission, instead of three transmissions per nibble.
+
+`setCursor()` is sent together with the characters written after it, the
+menus position the cursor and write a run of characters in one
+transmission.
+
+It can be the `DisplayClass` (see `LiquidMenu_config.h`) or be used
+through a driver:
+
+~~~{.cpp}
+LiquidPCF8574 lcd(0x27);
+auto lcd_driver = make_liquidDriver(lcd);
+LiquidMenu menu(lcd_driver, welcome_screen);
+
+void setup() {
+  Wire.begin();
+  lcd.begin(16, 2);
+  menu.init();
+}
+~~~
+
+The pins of the backpack are expected to be connected as on the common
+modules: P0 - RS, P1 - R/W, P2 - E, P3 - backlight, P4..P7 - D4..D7.
+
+@note The enable pulse and the execution time of a command are covered
+by the duration of the bytes on the bus, which holds up to a 400 kHz I2C
+clock. `clear()` and `home()` wait for the display.
+*/
+class LiquidPCF8574 : public Print {
+public:
+  /// The main constructor.
+  /**
+  @param address - the I2C address of the PCF8574
+  @param &wire - the I2C bus
+  */
+  explicit LiquidPCF8574(uint8_t address, TwoWire &wire = Wire)
+    : _p_wire(&wire), _address(address), _pins(0), _backlight(BACKLIGHT),
+      _cursorCommand(0), _queued(0), _displayControl(0), _rowOffsets{0} {}
+
+  /// Initializes the display.
+  /**
+  The I2C bus has to be initialized (`Wire.begin()`) before.
+
+  @param columns - the count of columns of the display
+  @param rows - the count of rows of the display
+  */
+  void begin(uint8_t columns, uint8_t rows) {
+    _rowOffsets[0] = 0x00;
+    _rowOffsets[1] = 0x40;
+    _rowOffsets[2] = columns;
+    _rowOffsets[3] = 0x40 + columns;
+    delay(50);
+    // The display starts in 8-bit mode, the sequence from its datasheet
+    // switches it to 4-bit mode from any state.
+    open();
+    put(_backlight);
+    close();
+    const uint16_t waits[] = {4500, 4500, 150};
+    for (uint8_t i = 0; i < 3; i++) {
+      open();
+      put_nibble(_backlight | 0x30);
+      close();
+      delayMicroseconds(waits[i]);
+    }
+    open();
+    put_nibble(_backlight | 0x20);
+    queue(FUNCTION_SET | (rows > 1 ? TWO_LINES : 0), 0);
+    _displayControl = DISPLAY_ON;
+    queue(DISPLAY_CONTROL | _displayControl, 0);
+    queue(ENTRY_MODE | ENTRY_INCREMENT, 0);
+    close();
+    clear();
+  }
+
+  /// Clears the display and moves the cursor home.
+  void clear() {
+    _cursorCommand = 0;
+    command(CLEAR);
+    delayMicroseconds(CLEAR_US);
+  }
+
+  /// Moves the cursor home.
+  void home() {
+    _cursorCommand = 0;
+    command(HOME);
+    delayMicroseconds(CLEAR_US);
+  }
+
+  /// Positions the cursor.
+  /**
+  The command is sent with the next transmission.
+
+  @param column - the column
+  @param row - the row
+  */
+  void setCursor(uint8_t column, uint8_t row) {
+    if (row > 3) {
+      row = 3;
+    }
+    _cursorCommand = SET_ADDRESS | (_rowOffsets[row] + column);
+  }
+
+  /// Writes a character at the cursor.
+  /**
+  @param character - the character
+  @returns the count of written characters
+  */
+  virtual size_t write(uint8_t character) {
+    open();
+    queue(character, RS);
+    close();
+    return 1;
+  }
+
+  /// Writes characters at the cursor in as few transmissions as possible.
+  /**
+  @param buffer - the characters
+  @param size - the count of the characters
+  @returns the count of written characters
+  */
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    open();
+    for (size_t i = 0; i < size; i++) {
+      queue(buffer[i], RS);
+    }
+    close();
+    return size;
+  }
+
+  using Print::write;
+
+  /// Uploads a glyph to the display's CGRAM.
+  /**
+  @param index - the glyph's index (0 - 7)
+  @param glyph[] - the glyph's bitmap
+  */
+  void createChar(uint8_t index, uint8_t glyph[]) {
+    open();
+    queue(SET_CGRAM_ADDRESS | ((index & 0x7) << 3), 0);
+    for (uint8_t i = 0; i < 8; i++) {
+      queue(glyph[i], RS);
+    }
+    close();
+  }
+
+  /// Turns the display on.
+  void display() {
+    set_displayControl(DISPLAY_ON, true);
+  }
+
+  /// Turns the display off, its content is kept.
+  void noDisplay() {
+    set_displayControl(DISPLAY_ON, false);
+  }
+
+  /// Shows the cursor as an underline.
+  void cursor() {
+    set_displayControl(CURSOR_ON, true);
+  }
+
+  /// Hides the underline cursor.
+  void noCursor() {
+    set_displayControl(CURSOR_ON, false);
+  }
+
+  /// Blinks the cursor's cell.
+  void blink() {
+    set_displayControl(BLINK_ON, true);
+  }
+
+  /// Stops blinking the cursor's cell.
+  void noBlink() {
+    set_displayControl(BLINK_ON, false);
+  }
+
+  /// Turns the backlight on.
+  void backlight() {
+    set_backlight(BACKLIGHT);
+  }
+
+  /// Turns the backlight off.
+  void noBacklight() {
+    set_backlight(0);
+  }
+
+  /// The bytes sent on the bus for positioning the cursor between runs.
+  /**
+  Four for the command, two for switching RS to it and back and about one
+  for starting another transmission.
+
+  @returns the cost of positioning the cursor
+  @see LiquidDisplayDriver::get_cursorCost()
+  */
+  uint8_t get_cursorCost() const {
+    return 7;
+  }
+
+  /// The bytes sent on the bus for writing a character.
+  /**
+  @returns the cost of writing a character
+  @see LiquidDisplayDriver::get_characterCost()
+  */
+  uint8_t get_characterCost() const {
+    return 4;
+  }
+
+private:
+  /// The outputs of the PCF8574.
+  enum Pin : uint8_t {
+    RS = 0x01,
+    ENABLE = 0x04,
+    BACKLIGHT = 0x08,
+  };
+
+  /// The commands of the HD44780.
+  enum Command : uint8_t {
+    CLEAR = 0x01,
+    HOME = 0x02,
+    ENTRY_MODE = 0x04,
+    ENTRY_INCREMENT = 0x02,
+    DISPLAY_CONTROL = 0x08,
+    DISPLAY_ON = 0x04,
+    CURSOR_ON = 0x02,
+    BLINK_ON = 0x01,
+    FUNCTION_SET = 0x20,
+    TWO_LINES = 0x08,
+    SET_CGRAM_ADDRESS = 0x40,
+    SET_ADDRESS = 0x80,
+  };
+
+  /// The count of bytes the `Wire` library sends in one transmission.
+#if defined(I2C_BUFFER_LENGTH)
+  static const uint8_t BURST_BYTES = I2C_BUFFER_LENGTH;
+#elif defined(BUFFER_LENGTH)
+  static const uint8_t BURST_BYTES = BUFFER_LENGTH;
+#else
+  static const uint8_t BURST_BYTES = 32;
+#endif
+
+  /// The longest execution time of clear and home, the datasheet's 1.52 ms
+  /// scaled to the slowest oscillator (190 kHz instead of 270 kHz).
+  static const uint16_t CLEAR_US = 2160;
+
+  /// Sends a command in its own transmission.
+  /**
+  @param value - the command
+  */
+  void command(uint8_t value) {
+    open();
+    queue(value, 0);
+    close();
+  }
+
+  /// Sets or clears a flag of the display control command and sends it.
+  /**
+  @param flag - the flag
+  @param set - true to set the flag
+  */
+  void set_displayControl(uint8_t flag, bool set) {
+    if (set) {
+      _displayControl |= flag;
+    } else {
+      _displayControl &= ~flag;
+    }
+    command(DISPLAY_CONTROL | _displayControl);
+  }
+
+  /// Switches the backlight output.
+  /**
+  @param backlight - `BACKLIGHT` or 0
+  */
+  void set_backlight(uint8_t backlight) {
+    _backlight = backlight;
+    open();
+    put((_pins & ~BACKLIGHT) | _backlight);
+    close();
+  }
+
+  /// Begins a transmission and queues the pending cursor position.
+  void open() {
+    _p_wire->beginTransmission(_address);
+    _queued = 0;
+    if (_cursorCommand) {
+      const uint8_t cursorCommand = _cursorCommand;
+      _cursorCommand = 0;
+      queue(cursorCommand, 0);
+    }
+  }
+
+  /// Ends the transmission.
+  void close() {
+    _p_wire->endTransmission();
+  }
+
+  /// Queues a byte for the display as two nibbles.
+  /**
+  Continues in a new transmission when the byte doesn't fit in this one.
+
+  @param value - the byte
+  @param rs - `RS` for data, 0 for a command
+  */
+  void queue(uint8_t value, uint8_t rs) {
+    if (_queued + 5 > BURST_BYTES) {
+      close();
+      _p_wire->beginTransmission(_address);
+      _queued = 0;
+    }
+    const uint8_t pins = rs | _backlight;
+    // RS settles before the enable pulse when it changes.
+    if ((_pins & RS) != rs) {
+      put(pins);
+    }
+    put_nibble(pins | (value & 0xF0));
+    put_nibble(pins | (value << 4));
+  }
+
+  /// Queues a nibble latched by an enable pulse.
+  /**
+  @param pins - the outputs, with the nibble in the upper half
+  */
+  void put_nibble(uint8_t pins) {
+    put(pins | ENABLE);
+    put(pins);
+  }
+
+  /// Queues a byte for the PCF8574.
+  /**
+  @param pins - the outputs
+  */
+  void put(uint8_t pins) {
+    _p_wire->write(pins);
+    _queued++;
+    _pins = pins;
+  }
+
+  TwoWire *_p_wire; ///< The I2C bus
+  uint8_t _address; ///< The I2C address
+  uint8_t _pins; ///< The last outputs
+  uint8_t _backlight; ///< The backlight output
+  uint8_t _cursorCommand; ///< The pending cursor command or 0
+  uint8_t _queued; ///< Count of the bytes in the transmission
+  uint8_t _displayControl; ///< The flags of the display control command
+  uint8_t _rowOffsets[4]; ///< The address of the first cell of every row
+};
@@ -0,0 +1,302 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Vasil Kalchev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/**
+@file
+Contains the LiquidParallel class definition.
+*/
+
+#include "LiquidParallel.h"
+
+/// The instructions of the HD44780.
+enum Hd44780Instruction : uint8_t {
+  CLEAR = 0x01,
+  HOME = 0x02,
+  ENTRY_MODE = 0x04,
+  ENTRY_INCREMENT = 0x02,
+  DISPLAY_CONTROL = 0x08,
+  DISPLAY_ON = 0x04,
+  CURSOR_ON = 0x02,
+  BLINK_ON = 0x01,
+  FUNCTION_SET = 0x20,
+  TWO_LINES = 0x08,
+  SET_CGRAM_ADDRESS = 0x40,
+  SET_ADDRESS = 0x80,
+  BUSY_FLAG = 0x80,
+};
+
+// The execution times from the datasheet scaled to the slowest oscillator
+// (190 kHz instead of 270 kHz).
+/// The longest execution time of an instruction or a data write.
+static const uint16_t EXECUTION_US = 53;
+/// The longest execution time of clear and home.
+static const uint16_t CLEAR_US = 2160;
+
+LiquidParallel::LiquidParallel(uint8_t rs, uint8_t enable,
+                               uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7)
+  : LiquidParallel(rs, NO_PIN, enable, d4, d5, d6, d7) {}
+
+LiquidParallel::LiquidParallel(uint8_t rs, uint8_t rw, uint8_t enable,
+                               uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7)
+  : _rsPin(rs), _rwPin(rw), _enablePin(enable), _dataPins{d4, d5, d6, d7},
+    _dataLevels(0), _rsLevel(LOW), _displayControl(0), _rows(1), _rowOffsets{0},
+    _executionUs(EXECUTION_US), _busyUs(0), _sentUs(0) {}
+
+void LiquidParallel::begin(uint8_t columns, uint8_t rows) {
+  _rows = rows;
+  _rowOffsets[0] = 0x00;
+  _rowOffsets[1] = 0x40;
+  _rowOffsets[2] = columns;
+  _rowOffsets[3] = 0x40 + columns;
+  pinMode(_rsPin, OUTPUT);
+  pinMode(_enablePin, OUTPUT);
+  if (_rwPin != NO_PIN) {
+    pinMode(_rwPin, OUTPUT);
+    digitalWrite(_rwPin, LOW);
+  }
+  for (uint8_t i = 0; i < 4; i++) {
+    pinMode(_dataPins[i], OUTPUT);
+    digitalWrite(_dataPins[i], LOW);
+  }
+  _dataLevels = 0;
+  _rsLevel = LOW;
+  digitalWrite(_rsPin, LOW);
+  digitalWrite(_enablePin, LOW);
+  delay(50);
+  // The display starts in 8-bit mode, the sequence from its datasheet
+  // switches it to 4-bit mode from any state. The busy flag can't be
+  // read before that.
+  const uint16_t waits[] = {4500, 4500, 150};
+  for (uint8_t i = 0; i < 3; i++) {
+    write_nibble(0x3);
+    delayMicroseconds(waits[i]);
+  }
+  write_nibble(0x2);
+  _sentUs = micros();
+  _busyUs = EXECUTION_US;
+  command(FUNCTION_SET | (rows > 1 ? TWO_LINES : 0));
+  _displayControl = DISPLAY_ON;
+  command(DISPLAY_CONTROL | _displayControl);
+  clear();
+  command(ENTRY_MODE | ENTRY_INCREMENT);
+  if (_rwPin != NO_PIN) {
+    calibrate();
+  }
+}
+
+void LiquidParallel::clear() {
+  command(CLEAR);
+}
+
+void LiquidParallel::home() {
+  command(HOME);
+}
+
+void LiquidParallel::setCursor(uint8_t column, uint8_t row) {
+  if (row > 3) {
+    row = 3;
+  }
+  if (row >= _rows) {
+    row = _rows - 1;
+  }
+  command(SET_ADDRESS | (_rowOffsets[row] + column));
+}
+
+size_t LiquidParallel::write(uint8_t character) {
+  send(character, HIGH);
+  return 1;
+}
+
+void LiquidParallel::createChar(uint8_t index, uint8_t glyph[]) {
+  command(SET_CGRAM_ADDRESS | ((index & 0x7) << 3));
+  for (uint8_t i = 0; i < 8; i++) {
+    send(glyph[i], HIGH);
+  }
+}
+
+void LiquidParallel::command(uint8_t value) {
+  send(value, LOW);
+}
+
+void LiquidParallel::display() {
+  set_displayControl(DISPLAY_ON, true);
+}
+
+void LiquidParallel::noDisplay() {
+  set_displayControl(DISPLAY_ON, false);
+}
+
+void LiquidParallel::cursor() {
+  set_displayControl(CURSOR_ON, true);
+}
+
+void LiquidParallel::noCursor() {
+  set_displayControl(CURSOR_ON, false);
+}
+
+void LiquidParallel::blink() {
+  set_displayControl(BLINK_ON, true);
+}
+
+void LiquidParallel::noBlink() {
+  set_displayControl(BLINK_ON, false);
+}
+
+uint8_t LiquidParallel::get_cursorCost() const {
+  return 1;
+}
+
+uint8_t LiquidParallel::get_characterCost() const {
+  return 1;
+}
+
+void LiquidParallel::set_displayControl(uint8_t flag, bool set) {
+  if (set) {
+    _displayControl |= flag;
+  } else {
+    _displayControl &= ~flag;
+  }
+  command(DISPLAY_CONTROL | _displayControl);
+}
+
+void LiquidParallel::send(uint8_t value, uint8_t rs) {
+  wait_ready();
+  if (rs != _rsLevel) {
+    digitalWrite(_rsPin, rs);
+    _rsLevel = rs;
+  }
+  write_nibble(value >> 4);
+  write_nibble(value);
+  _sentUs = micros();
+  // Clear and home take much longer than the rest, in proportion.
+  if ((rs == LOW) && (value < ENTRY_MODE)) {
+    _busyUs = (uint32_t)CLEAR_US * _executionUs / EXECUTION_US;
+  } else {
+    _busyUs = _executionUs;
+  }
+}
+
+void LiquidParallel::write_nibble(uint8_t nibble) {
+  nibble &= 0xF;
+  const uint8_t changed = nibble ^ _dataLevels;
+  for (uint8_t i = 0; i < 4; i++) {
+    if (changed & (1 << i)) {
+      digitalWrite(_dataPins[i], (nibble >> i) & 0x1);
+    }
+  }
+  _dataLevels = nibble;
+  pulse_enable();
+}
+
+void LiquidParallel::pulse_enable() {
+  digitalWrite(_enablePin, HIGH);
+  delayMicroseconds(1);
+  digitalWrite(_enablePin, LOW);
+  delayMicroseconds(1);
+}
+
+void LiquidParallel::wait_ready() {
+  while (micros() - _sentUs < _busyUs) {}
+}
+
+void LiquidParallel::calibrate() {
+  // Every probe sets the address counter and reads the busy flag once.
+  // The first one reads it right away, which shows how long the reading
+  // itself takes, the rest read it halfway between the longest time found
+  // busy and the shortest found ready.
+  uint16_t busyUs = 0;
+  uint16_t readyUs = EXECUTION_US;
+  uint16_t leadUs = 0;
+  // The reading is trusted only after it returned the address that was
+  // set, with bit 3 on D7 like the busy flag. Without it a flag that never
+  // reads ready (e.g. no display and pull-ups) or never busy (e.g. a broken
+  // wire) keeps the datasheet's time.
+  bool isRead = false;
+  for (uint8_t probe = 0; probe < 7; probe++) {
+    const uint8_t address = 0x08 | probe;
+    command(SET_ADDRESS | address);
+    const uint16_t targetUs = (probe == 0) ? 0 : (busyUs + readyUs) / 2;
+    while (micros() - _sentUs + leadUs < targetUs) {}
+    uint32_t readUs;
+    const uint8_t status = read_status(readUs);
+    const uint32_t elapsedUs = readUs - _sentUs;
+    if (probe == 0) {
+      leadUs = elapsedUs;
+    }
+    if (status & BUSY_FLAG) {
+      if ((elapsedUs > busyUs) && (elapsedUs < readyUs)) {
+        busyUs = elapsedUs;
+      }
+    } else if (status == address) {
+      isRead = true;
+      if (elapsedUs < readyUs) {
+        readyUs = elapsedUs;
+      }
+    }
+    _busyUs = EXECUTION_US;
+  }
+  command(SET_ADDRESS);
+  if (!isRead) {
+    return;
+  }
+  // The oscillator of the display slows down with the temperature and
+  // micros() counts in steps of up to 4 microseconds.
+  _executionUs = readyUs + readyUs / 4 + 4;
+  if (_executionUs > EXECUTION_US) {
+    _executionUs = EXECUTION_US;
+  }
+}
+
+uint8_t LiquidParallel::read_status(uint32_t &readUs) {
+  for (uint8_t i = 0; i < 4; i++) {
+    pinMode(_dataPins[i], INPUT);
+  }
+  if (_rsLevel != LOW) {
+    digitalWrite(_rsPin, LOW);
+    _rsLevel = LOW;
+  }
+  digitalWrite(_rwPin, HIGH);
+  // The busy flag is D7 of the first nibble, the second one is the rest
+  // of the address counter.
+  uint8_t status = 0;
+  for (uint8_t nibble = 0; nibble < 2; nibble++) {
+    digitalWrite(_enablePin, HIGH);
+    delayMicroseconds(1);
+    if (nibble == 0) {
+      readUs = micros();
+    }
+    for (uint8_t i = 0; i < 4; i++) {
+      status = (status << 1) | (digitalRead(_dataPins[3 - i]) == HIGH);
+    }
+    digitalWrite(_enablePin, LOW);
+    delayMicroseconds(1);
+  }
+  digitalWrite(_rwPin, LOW);
+  for (uint8_t i = 0; i < 4; i++) {
+    pinMode(_dataPins[i], OUTPUT);
+    digitalWrite(_dataPins[i], (_dataLevels >> i) & 0x1);
+  }
+  return status;
+}
@@ -0,0 +1,220 @@
+/*
+The MIT License (MIT)
+
+Copyright (c) 2016 Vasil Kalchev
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/**
+@file
+Contains the LiquidParallel class declaration.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <Arduino.h>
+#include <Print.h>
+
+
+/// Drives an HD44780 display through its parallel 4-bit interface.
+/**
+A replacement for the `LiquidCrystal` library which doesn't wait a fixed
+100 microseconds after every nibble. The wait for the display happens
+before the next instruction, the time spent since the previous one counts
+towards it, and lasts only the execution time of the instruction:
+
+- With the R/W pin connected the execution time of this display is
+  measured by `begin()` with its busy flag. If the address counter
+  can't be read back the longest time from the datasheet is kept.
+- With the R/W pin connected to ground the longest execution time from
+  the datasheet is used.
+
+Only the data pins whose level changes are written.
+
+It can be the `DisplayClass` (see `LiquidMenu_config.h`) or be used
+through a driver:
+
+~~~{.cpp}
+LiquidParallel lcd(12, 10, 11, 5, 4, 3, 2);
+LiquidMenu menu(lcd, welcome_screen);
+
+void setup() {
+  lcd.begin(16, 2);
+}
+~~~
+*/
+class LiquidParallel : public Print {
+public:
+  /// Constructor for a display with its R/W pin connected to ground.
+  /**
+  @param rs - the pin connected to RS
+  @param enable - the pin connected to E
+  @param d4 - the pin connected to D4
+  @param d5 - the pin connected to D5
+  @param d6 - the pin connected to D6
+  @param d7 - the pin connected to D7
+  */
+  LiquidParallel(uint8_t rs, uint8_t enable,
+                 uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7);
+
+  /// Constructor for a display whose busy flag is read.
+  /**
+  @param rs - the pin connected to RS
+  @param rw - the pin connected to R/W
+  @param enable - the pin connected to E
+  @param d4 - the pin connected to D4
+  @param d5 - the pin connected to D5
+  @param d6 - the pin connected to D6
+  @param d7 - the pin connected to D7
+  */
+  LiquidParallel(uint8_t rs, uint8_t rw, uint8_t enable,
+                 uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7);
+
+  /// Initializes the display.
+  /**
+  @param columns - the count of columns of the display
+  @param rows - the count of rows of the display
+  */
+  void begin(uint8_t columns, uint8_t rows);
+
+  /// Clears the display and moves the cursor home.
+  void clear();
+
+  /// Moves the cursor home.
+  void home();
+
+  /// Positions the cursor.
+  /**
+  @param column - the column
+  @param row - the row
+  */
+  void setCursor(uint8_t column, uint8_t row);
+
+  /// Writes a character at the cursor.
+  /**
+  @param character - the character
+  @returns the count of written characters
+  */
+  virtual size_t write(uint8_t character);
+
+  using Print::write;
+
+  /// Uploads a glyph to the display's CGRAM.
+  /**
+  @param index - the glyph's index (0 - 7)
+  @param glyph[] - the glyph's bitmap
+  */
+  void createChar(uint8_t index, uint8_t glyph[]);
+
+  /// Sends an instruction to the display.
+  /**
+  @param value - the instruction
+  */
+  void command(uint8_t value);
+
+  /// Turns the display on.
+  void display();
+
+  /// Turns the display off, its content is kept.
+  void noDisplay();
+
+  /// Shows the cursor as an underline.
+  void cursor();
+
+  /// Hides the underline cursor.
+  void noCursor();
+
+  /// Blinks the cursor's cell.
+  void blink();
+
+  /// Stops blinking the cursor's cell.
+  void noBlink();
+
+  /// The cost of positioning the cursor between runs.
+  /**
+  Positioning the cursor is one instruction, like writing a character.
+
+  @returns the cost of positioning the cursor
+  @see LiquidDisplayDriver::get_cursorCost()
+  */
+  uint8_t get_cursorCost() const;
+
+  /// The cost of writing a character.
+  /**
+  @returns the cost of writing a character
+  @see LiquidDisplayDriver::get_characterCost()
+  */
+  uint8_t get_characterCost() const;
+
+private:
+  /// The pin of R/W when it's connected to ground.
+  static const uint8_t NO_PIN = 0xFF;
+
+  /// Sets or clears a flag of the display control instruction and sends it.
+  /**
+  @param flag - the flag
+  @param set - true to set the flag
+  */
+  void set_displayControl(uint8_t flag, bool set);
+
+  /// Sends a byte to the display when it's ready for it.
+  /**
+  @param value - the byte
+  @param rs - `HIGH` for data, `LOW` for an instruction
+  */
+  void send(uint8_t value, uint8_t rs);
+
+  /// Puts a nibble on the data pins and latches it.
+  /**
+  @param nibble - the nibble, in the lower half
+  */
+  void write_nibble(uint8_t nibble);
+
+  /// Pulses the enable pin.
+  void pulse_enable();
+
+  /// Waits until the display finishes the last instruction.
+  void wait_ready();
+
+  /// Measures the execution time of the display with its busy flag.
+  void calibrate();
+
+  /// Reads the busy flag and the address counter of the display.
+  /**
+  @param &readUs - set to the time the busy flag was read
+  @returns the busy flag in bit 7 and the address counter
+  */
+  uint8_t read_status(uint32_t &readUs);
+
+  uint8_t _rsPin; ///< The pin connected to RS
+  uint8_t _rwPin; ///< The pin connected to R/W or `NO_PIN`
+  uint8_t _enablePin; ///< The pin connected to E
+  uint8_t _dataPins[4]; ///< The pins connected to D4..D7
+  uint8_t _dataLevels; ///< The levels of the data pins
+  uint8_t _rsLevel; ///< The level of the RS pin
+  uint8_t _displayControl; ///< The flags of the display control instruction
+  uint8_t _rows; ///< The count of rows of the display
+  uint8_t _rowOffsets[4]; ///< The address of the first cell of every row
+  uint16_t _executionUs; ///< The execution time of an instruction
+  uint16_t _busyUs; ///< The execution time of the last instruction
+  uint32_t _sentUs; ///< When the last instruction was sent
+};
@@ -1,6 +1,6 @@
 /**
 @file
-Contains the LiquidScreen class definition.
+Contains the LiquidScreenBase and LiquidScreen class definitions.
 */
 
 /*
@@ -30,56 +30,70 @@ SOFTWARE.
 #include "LiquidMenu.h"
 
 
-/// Line count subtrahend for comparison during focus iteration
-/**
-0 - "ghosting" is enabled
-1 - "ghosting" is disabled
-*/
-#define LM_LINE_COUNT_SUBTRAHEND (0)
+/// Hides the focus for one step after the last focusable line.
+static const bool FOCUS_GHOSTING = (LM_FOCUS_INDICATOR_GHOSTING == true);
+
+uint16_t LiquidScreenBase::_hiddenChanges = 0;
 
-#if LM_FOCUS_INDICATOR_GHOSTING == true
-	#undef LM_LINE_COUNT_SUBTRAHEND
-	#define LM_LINE_COUNT_SUBTRAHEND (0)
-#elif LM_FOCUS_INDICATOR_GHOSTING == false
-	#undef LM_LINE_COUNT_SUBTRAHEND
-	#define LM_LINE_COUNT_SUBTRAHEND (1)
-#endif
 
+LiquidScreenBase::LiquidScreenBase(LiquidLineBase **p_liquidLine, uint8_t lineCapacity,
+                                   uint8_t *p_focusableBits, uint8_t focusableCapacity)
+	: _p_liquidLine(p_liquidLine), _lineCapacity(lineCapacity),
+	  _lineCount(0), _focus(0), _displayLineCount(0), _hidden(false),
+	  _focusableLines(p_focusableBits, focusableCapacity),
+	  _focusableSync(LiquidLineBase::_focusableChanges) {}
+
+LiquidScreenBase::LiquidScreenBase(const LiquidScreenBase &other, LiquidLineBase **p_liquidLine,
+                                   uint8_t *p_focusableBits)
+	: _p_liquidLine(p_liquidLine), _lineCapacity(other._lineCapacity),
+	  _lineCount(other._lineCount), _focus(other._focus),
+	  _displayLineCount(other._displayLineCount), _hidden(other._hidden),
+	  _focusableLines(p_focusableBits, other._focusableLines.get_capacity()),
+	  _focusableSync(other._focusableSync) {
+	for (uint8_t l = 0; (l < _lineCount) && (_p_liquidLine != nullptr); l++) {
+		_p_liquidLine[l] = other._p_liquidLine[l];
+	}
+	_focusableLines.copy(other._focusableLines);
+}
 
 
 LiquidScreen::LiquidScreen()
-	: _lineCount(0), _focus(0), _hidden(false) {}
+	: LiquidScreenBase(_liquidLine, MAX_LINES, _focusableBits, MAX_LINES) {}
 
-LiquidScreen::LiquidScreen(LiquidLine &liquidLine)
+LiquidScreen::LiquidScreen(LiquidLineBase &liquidLine)
 	: LiquidScreen() {
 	add_line(liquidLine);
 }
 
-LiquidScreen::LiquidScreen(LiquidLine &liquidLine1, LiquidLine &liquidLine2)
+LiquidScreen::LiquidScreen(LiquidLineBase &liquidLine1, LiquidLineBase &liquidLine2)
 	: LiquidScreen(liquidLine1) {
 	add_line(liquidLine2);
 }
 
-LiquidScreen::LiquidScreen(LiquidLine &liquidLine1, LiquidLine &liquidLine2,
-                           LiquidLine &liquidLine3)
+LiquidScreen::LiquidScreen(LiquidLineBase &liquidLine1, LiquidLineBase &liquidLine2,
+                           LiquidLineBase &liquidLine3)
 	: LiquidScreen(liquidLine1, liquidLine2) {
 	add_line(liquidLine3);
 }
 
-LiquidScreen::LiquidScreen(LiquidLine &liquidLine1, LiquidLine &liquidLine2,
-                           LiquidLine &liquidLine3, LiquidLine &liquidLine4)
+LiquidScreen::LiquidScreen(LiquidLineBase &liquidLine1, LiquidLineBase &liquidLine2,
+                           LiquidLineBase &liquidLine3, LiquidLineBase &liquidLine4)
 	: LiquidScreen(liquidLine1, liquidLine2, liquidLine3) {
 	add_line(liquidLine4);
 }
 
-bool LiquidScreen::add_line(LiquidLine &liquidLine) {
+LiquidScreen::LiquidScreen(const LiquidScreen &other)
+	: LiquidScreenBase(other, _liquidLine, _focusableBits) {}
+
+bool LiquidScreenBase::add_line(LiquidLineBase &liquidLine) {
 	DEBUG(F("LScreen ")); print_me(reinterpret_cast<uintptr_t>(this));
 
 	DEBUG(F("Add line (0x")); DEBUG((uintptr_t)&liquidLine);
 	DEBUG(F(") count(")) DEBUG(_lineCount); DEBUG(F(")"));
 
-	if (_lineCount < MAX_LINES) {
+	if (_lineCount < _lineCapacity) {
 		_p_liquidLine[_lineCount] = &liquidLine;
+		_focusableLines.set(_lineCount, liquidLine._focusable);
 		_lineCount++;
 
 		// set the focus indicator equal to the amount of lines, which
@@ -89,7 +103,7 @@ bool LiquidScreen::add_line(LiquidLine &liquidLine) {
 		// Naively set the number of lines the display has to the
 		// number of added LiquidLine objects. When adding more
         // LiquidLine objects that the display's number of lines,
-        // void LiquidScreen::set_displayLineCount(uint8_t lines)
+        // void LiquidScreenBase::set_displayLineCount(uint8_t lines)
         // must be used to set the number of lines the display has.
 	    _displayLineCount = _lineCount;
 
@@ -102,7 +116,7 @@ bool LiquidScreen::add_line(LiquidLine &liquidLine) {
 
 }
 
-bool LiquidScreen::set_focusPosition(Position position) {
+bool LiquidScreenBase::set_focusPosition(Position position) {
 	DEBUG(F("LScreen ")); print_me(reinterpret_cast<uintptr_t>(this));
 
 	if (position == Position::CUSTOM) {
@@ -111,21 +125,54 @@ bool LiquidScreen::set_focusPosition(Position position) {
 	} else {
 		DEBUG(F("Focus position set to : ")); DEBUGLN((uint8_t)position);
 		for (uint8_t l = 0; l < _lineCount; l++) {
-			_p_liquidLine[l]->set_focusPosition(position);
+			get_line(l)->set_focusPosition(position);
 		}
 		return true;
 	}
 }
 
-void LiquidScreen::set_displayLineCount(uint8_t lines) {
+void LiquidScreenBase::set_displayLineCount(uint8_t lines) {
 	_displayLineCount = lines;
 }
 
-void LiquidScreen::hide(bool hide) {
-	_hidden = hide;
+void LiquidScreenBase::hide(bool hide) {
+	if (_hidden != hide) {
+		_hidden = hide;
+		_hiddenChanges++;
+	}
+}
+
+void LiquidScreenBase::set_lineCount(uint8_t lineCount) {
+	_lineCount = lineCount;
+	// the focus is invisible until it's switched, like after `add_line`
+	_focus = lineCount;
+	_displayLineCount = lineCount;
+	build_focusableLines();
+}
+
+void LiquidScreenBase::build_focusableLines() {
+	const uint8_t capacity = _focusableLines.get_capacity();
+	for (uint8_t l = 0; (l < _lineCount) && (l < capacity); l++) {
+		_focusableLines.set(l, get_line(l)->_focusable);
+	}
+	_focusableSync = LiquidLineBase::_focusableChanges;
+}
+
+void LiquidScreenBase::update_focusableLines() {
+	if (_focusableSync != LiquidLineBase::_focusableChanges) {
+		build_focusableLines();
+	}
+}
+
+void LiquidScreenBase::set_focus(uint8_t lineIndex) {
+	_focus = lineIndex;
 }
 
-void LiquidScreen::print(DisplayClass *p_liquidCrystal) const {
+LiquidLineBase* LiquidScreenBase::get_line(uint8_t index) const {
+	return _p_liquidLine[index];
+}
+
+void LiquidScreenBase::get_visibleLines(uint8_t &first, uint8_t &count) const {
 	uint8_t lOffset = 0;
 	uint8_t displayLineCount = _displayLineCount;
 	if (displayLineCount == 0) {
@@ -140,6 +187,40 @@ void LiquidScreen::print(DisplayClass *p_liquidCrystal) const {
 			lOffset = (_lineCount - displayLineCount);
 		}
 	}
+	first = lOffset;
+	count = displayLineCount;
+}
+
+bool LiquidScreenBase::schedule_refresh(uint32_t now, uint32_t elapsed,
+                                        uint16_t &wait) {
+	uint8_t lOffset, displayLineCount;
+	get_visibleLines(lOffset, displayLineCount);
+	bool due = false;
+	for (uint8_t l = lOffset; l < displayLineCount + lOffset; l++) {
+		if (get_line(l)->schedule_refresh(now, elapsed, wait)) {
+			due = true;
+		}
+	}
+	return due;
+}
+
+bool LiquidScreenBase::mark_changedLines() {
+	uint8_t lOffset, displayLineCount;
+	get_visibleLines(lOffset, displayLineCount);
+	bool changed = false;
+	for (uint8_t l = lOffset; l < displayLineCount + lOffset; l++) {
+		LiquidLineBase *p_line = get_line(l);
+		if (p_line->query_getters()) {
+			p_line->_refreshDue = true;
+			changed = true;
+		}
+	}
+	return changed;
+}
+
+void LiquidScreenBase::print(LiquidFrame *p_frame) const {
+	uint8_t lOffset, displayLineCount;
+	get_visibleLines(lOffset, displayLineCount);
 	uint8_t offsetRow = 0;
 	for (uint8_t l = lOffset; l < displayLineCount + lOffset; l++) {
 		bool focus = true;
@@ -150,46 +231,44 @@ void LiquidScreen::print(DisplayClass *p_liquidCrystal) const {
 			DEBUG(F("|   -->"));
 		}
 		DEBUG(F("\tLine ")); DEBUG(l);
+		LiquidLineBase *p_line = get_line(l);
 		if (displayLineCount < _lineCount) {
-			_p_liquidLine[l]->_row = offsetRow;
+			p_line->_row = offsetRow;
 		}
-		_p_liquidLine[l]->print(p_liquidCrystal, focus);
+		p_line->print(p_frame, focus);
 		offsetRow++;
 	}
 }
 
-void LiquidScreen::switch_focus(bool forward) {
+void LiquidScreenBase::switch_focus(bool forward) {
 	DEBUG(F("LScreen ")); print_me(reinterpret_cast<uintptr_t>(this));
 
-	// LM_LINE_COUNT_SUBTRAHEND:
-	// 0 - "ghosting" is enabled
-	// 1 - "ghosting" is disabled
-	
-	do {
-		if (forward) {
-			if (_focus < (_lineCount - LM_LINE_COUNT_SUBTRAHEND)) {
-				_focus++;
-				if (_focus == (_lineCount - LM_LINE_COUNT_SUBTRAHEND)) {
-					break;
-				}
-			} else {
-				_focus = 0;
-			}
-		} else { //else (forward)
-			if (_focus == 0) {
-				_focus = (_lineCount - LM_LINE_COUNT_SUBTRAHEND);
-				break;
-			} else {
-				_focus--;
-			}
-		} //else (forward)
-	} while (_p_liquidLine[_focus]->_focusable == false);
+	update_focusableLines();
+	// The focus is hidden at `_lineCount`. With "ghosting" it's hidden for
+	// one step after the last focusable line, without it it goes around.
+	// When no line is focusable it stays hidden.
+	uint8_t focus;
+	if (forward) {
+		const uint8_t from = (_focus < _lineCount) ? _focus + 1 : 0;
+		focus = _focusableLines.find_next(from, _lineCount);
+		if ((focus == _lineCount) && !FOCUS_GHOSTING) {
+			focus = _focusableLines.find_next(0, _lineCount);
+		}
+	} else {
+		focus = _focusableLines.find_previous(_focus);
+		if (focus == _focus) {
+			// no focusable line before the focused one
+			focus = FOCUS_GHOSTING ? _lineCount : _focusableLines.find_previous(_lineCount);
+		}
+	}
+	_focus = focus;
 
 	DEBUG(F("Focus switched to ")); DEBUGLN(_focus);
 }
 
-bool LiquidScreen::set_focusedLine(uint8_t lineIndex) {
-	if (lineIndex < _lineCount && _p_liquidLine[lineIndex]->_focusable == true) {
+bool LiquidScreenBase::set_focusedLine(uint8_t lineIndex) {
+	update_focusableLines();
+	if (lineIndex < _lineCount && _focusableLines.is_set(lineIndex)) {
 		_focus = lineIndex;
 		return true;
 	} else {
@@ -197,20 +276,20 @@ bool LiquidScreen::set_focusedLine(uint8_t lineIndex) {
 	}
 }
 
-uint8_t LiquidScreen::get_focusedLine() const {
+uint8_t LiquidScreenBase::get_focusedLine() const {
 	return _focus;
 }
 
-bool LiquidScreen::is_callable(uint8_t number) const {
+bool LiquidScreenBase::is_callable(uint8_t number) const {
 	if (_focus != _lineCount) {
-		return _p_liquidLine[_focus]->is_callable(number);
+		return get_line(_focus)->is_callable(number);
 	}
 	return false;
 }
 
-bool LiquidScreen::call_function(uint8_t number) const {
+bool LiquidScreenBase::call_function(uint8_t number) const {
 	if (_focus != _lineCount) {
-		return _p_liquidLine[_focus]->call_function(number);
+		return get_line(_focus)->call_function(number);
 	}
 	return false;
 }
@@ -34,28 +34,28 @@ LiquidSystem::LiquidSystem(uint8_t startingMenu)
 
 }
 
-LiquidSystem::LiquidSystem(LiquidMenu &liquidMenu1, LiquidMenu &liquidMenu2,
+LiquidSystem::LiquidSystem(LiquidMenuBase &liquidMenu1, LiquidMenuBase &liquidMenu2,
                            uint8_t startingMenu)
 	: LiquidSystem(startingMenu) {
 	add_menu(liquidMenu1);
 	add_menu(liquidMenu2);
 }
 
-LiquidSystem::LiquidSystem(LiquidMenu &liquidMenu1, LiquidMenu &liquidMenu2,
-                           LiquidMenu &liquidMenu3, uint8_t startingMenu)
+LiquidSystem::LiquidSystem(LiquidMenuBase &liquidMenu1, LiquidMenuBase &liquidMenu2,
+                           LiquidMenuBase &liquidMenu3, uint8_t startingMenu)
 	: LiquidSystem(liquidMenu1, liquidMenu2, startingMenu) {
 	add_menu(liquidMenu3);
 }
 
-LiquidSystem::LiquidSystem(LiquidMenu &liquidMenu1, LiquidMenu &liquidMenu2,
-                           LiquidMenu &liquidMenu3, LiquidMenu &liquidMenu4,
+LiquidSystem::LiquidSystem(LiquidMenuBase &liquidMenu1, LiquidMenuBase &liquidMenu2,
+                           LiquidMenuBase &liquidMenu3, LiquidMenuBase &liquidMenu4,
                            uint8_t startingMenu)
 	: LiquidSystem(liquidMenu1, liquidMenu2, liquidMenu3, startingMenu) {
 	add_menu(liquidMenu4);
 }
 
 
-bool LiquidSystem::add_menu(LiquidMenu &liquidMenu) {
+bool LiquidSystem::add_menu(LiquidMenuBase &liquidMenu) {
 	DEBUG(F("LMenu ")); print_me(reinterpret_cast<uintptr_t>(this));
 
   DEBUG(F("Add menu (0x")); DEBUG((uintptr_t)&liquidMenu);
@@ -73,12 +73,15 @@ bool LiquidSystem::add_menu(LiquidMenu &liquidMenu) {
 }
 
 
-bool LiquidSystem::change_menu(LiquidMenu &p_liquidMenu) {
+bool LiquidSystem::change_menu(LiquidMenuBase &p_liquidMenu) {
 	// _p_liquidMenu[_currentMenu]->_p_liquidCrystal->clear();
 	for (uint8_t m = 0; m < _menuCount; m++) {
 		// if ((uintptr_t)&p_liquidMenu == (uintptr_t) & (*_p_liquidMenu[m])) {
 		if (reinterpret_cast<uintptr_t>(&p_liquidMenu) == reinterpret_cast<uintptr_t>(&(*_p_liquidMenu[m]))) {
+			// The menus of one display share what it shows, the new menu
+			// sends only the characters that differ.
 			_currentMenu = m;
+			_p_liquidMenu[m]->_ticking = false;
 			DEBUG(F("Menu changed to ")); DEBUGLN(_currentMenu);
 			update();
 			return true;
@@ -89,11 +92,11 @@ bool LiquidSystem::change_menu(LiquidMenu &p_liquidMenu) {
 	return false;
 }
 
-LiquidScreen* LiquidSystem::get_currentScreen() const {
+LiquidScreenBase* LiquidSystem::get_currentScreen() const {
 	return _p_liquidMenu[_currentMenu]->get_currentScreen();
 }
 
-LiquidMenu* LiquidSystem::get_currentMenu() const {
+LiquidMenuBase* LiquidSystem::get_currentMenu() const {
 	return _p_liquidMenu[_currentMenu];
 }
 
@@ -125,7 +128,7 @@ bool LiquidSystem::change_screen(uint8_t number) {
 	return _p_liquidMenu[_currentMenu]->change_screen(number);
 }
 
-bool LiquidSystem::change_screen(LiquidScreen *p_liquidScreen) {
+bool LiquidSystem::change_screen(LiquidScreenBase *p_liquidScreen) {
 	return _p_liquidMenu[_currentMenu]->change_screen(p_liquidScreen);
 }
 
@@ -133,7 +136,7 @@ bool LiquidSystem::operator=(uint8_t number) {
 	return change_screen(number);
 }
 
-bool LiquidSystem::operator=(LiquidScreen *p_liquidScreen) {
+bool LiquidSystem::operator=(LiquidScreenBase *p_liquidScreen) {
 	return change_screen(p_liquidScreen);
 }
 
@@ -163,6 +166,15 @@ bool LiquidSystem::set_focusSymbol(Position position, uint8_t symbol[8]) {
 	return _p_liquidMenu[_currentMenu]->set_focusSymbol(position, symbol);
 }
 
+bool LiquidSystem::reserve_glyphSlot(uint8_t index) {
+	for (uint8_t m = 0; m < _menuCount; m++) {
+		if (!_p_liquidMenu[m]->reserve_glyphSlot(index)) {
+			return false;
+		}
+	}
+	return true;
+}
+
 bool LiquidSystem::is_callable(uint8_t number) const {
 	return _p_liquidMenu[_currentMenu]->is_callable(number);
 }
@@ -181,6 +193,57 @@ bool LiquidSystem::call_function(uint8_t number, bool refresh) const {
 	return returnValue;
 }
 
+void LiquidSystem::set_clearOnUpdate(bool clear) {
+	for (uint8_t m = 0; m < _menuCount; ++m) {
+		_p_liquidMenu[m]->set_clearOnUpdate(clear);
+	}
+}
+
+LiquidStats LiquidSystem::get_stats() const {
+	LiquidStats stats;
+	memset(&stats, 0, sizeof(stats));
+	for (uint8_t m = 0; m < _menuCount; ++m) {
+		const LiquidStats &menuStats = _p_liquidMenu[m]->get_stats();
+		stats.frames += menuStats.frames;
+		stats.characters += menuStats.characters;
+		stats.cursorMoves += menuStats.cursorMoves;
+		stats.rewrites += menuStats.rewrites;
+		stats.clears += menuStats.clears;
+		stats.glyphUploads += menuStats.glyphUploads;
+		if (menuStats.maxRenderUs > stats.maxRenderUs) {
+			stats.maxRenderUs = menuStats.maxRenderUs;
+		}
+	}
+	if (_currentMenu < _menuCount) {
+		stats.lastRenderUs = _p_liquidMenu[_currentMenu]->get_stats().lastRenderUs;
+	}
+	return stats;
+}
+
+void LiquidSystem::reset_stats() {
+	for (uint8_t m = 0; m < _menuCount; ++m) {
+		_p_liquidMenu[m]->reset_stats();
+	}
+}
+
+bool LiquidSystem::set_displaySize(uint8_t columns, uint8_t rows) {
+	bool fits = true;
+	for (uint8_t m = 0; m < _menuCount; ++m) {
+		fits = _p_liquidMenu[m]->set_displaySize(columns, rows) && fits;
+	}
+	return fits;
+}
+
+void LiquidSystem::set_deferredUpdate(bool deferred) {
+	for (uint8_t m = 0; m < _menuCount; ++m) {
+		_p_liquidMenu[m]->set_deferredUpdate(deferred);
+	}
+}
+
+bool LiquidSystem::poll(uint32_t budgetUs) {
+	return _p_liquidMenu[_currentMenu]->poll(budgetUs);
+}
+
 void LiquidSystem::update() const {
 	_p_liquidMenu[_currentMenu]->update();
 }
@@ -188,3 +251,20 @@ void LiquidSystem::update() const {
 void LiquidSystem::softUpdate() const {
 	_p_liquidMenu[_currentMenu]->softUpdate();
 }
+
+void LiquidSystem::refresh_line(LiquidLineBase &liquidLine) const {
+	_p_liquidMenu[_currentMenu]->refresh_line(liquidLine);
+}
+
+void LiquidSystem::refresh_variable(LiquidLineBase &liquidLine,
+                                    uint8_t number) const {
+	_p_liquidMenu[_currentMenu]->refresh_variable(liquidLine, number);
+}
+
+uint32_t LiquidSystem::tick(uint32_t now) {
+	return _p_liquidMenu[_currentMenu]->tick(now);
+}
+
+bool LiquidSystem::refresh_getters() const {
+	return _p_liquidMenu[_currentMenu]->refresh_getters();
+}
@@ -66,6 +66,11 @@ DataType recognizeType(double variable) {
 	variable = variable;
 }
 
+DataType recognizeType(uint8_t* variable) {
+	return DataType::GLYPH_BITMAP;
+	variable = variable;
+}
+
 
 DataType recognizeType(boolFnPtr variable) {
 	return DataType::BOOL_GETTER;
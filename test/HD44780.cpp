@@ -0,0 +1,127 @@
+/**
+@file
+Contains the HD44780 class definition.
+*/
+
+#include "HD44780.h"
+
+#include <string.h>
+
+HD44780::HD44780(uint8_t columns, uint8_t rows) {
+  set_size(columns, rows);
+  reset();
+}
+
+void HD44780::reset() {
+  memset(_ddram, ' ', sizeof(_ddram));
+  memset(_cgram, 0, sizeof(_cgram));
+  _address = 0;
+  _cgramSelected = false;
+  _increment = true;
+  _twoLines = false;
+  reset_counters();
+}
+
+void HD44780::set_size(uint8_t columns, uint8_t rows) {
+  _columns = columns;
+  _rows = rows;
+}
+
+void HD44780::reset_counters() {
+  memset(&_counters, 0, sizeof(_counters));
+}
+
+uint16_t HD44780::instruction(uint8_t code) {
+  uint16_t busyUs = EXECUTION_US;
+  _counters.instructions++;
+  if (code & 0x80) {
+    // Set DDRAM address
+    _address = code & 0x7F;
+    _cgramSelected = false;
+    _counters.addresses++;
+  } else if (code & 0x40) {
+    // Set CGRAM address
+    _address = code & 0x3F;
+    _cgramSelected = true;
+  } else if (code & 0x20) {
+    // Function set
+    _twoLines = (code & 0x08) != 0;
+  } else if (code & 0x18) {
+    // Cursor or display shift and display on/off control don't change
+    // the memory.
+  } else if (code & 0x04) {
+    // Entry mode set, shifting the display isn't modelled
+    _increment = (code & 0x02) != 0;
+  } else if (code & 0x02) {
+    // Return home
+    _address = 0;
+    _cgramSelected = false;
+    busyUs = CLEAR_US;
+    _counters.clears++;
+  } else if (code & 0x01) {
+    // Clear display
+    memset(_ddram, ' ', sizeof(_ddram));
+    _address = 0;
+    _cgramSelected = false;
+    _increment = true;
+    busyUs = CLEAR_US;
+    _counters.clears++;
+  }
+  _counters.busyUs += busyUs;
+  return busyUs;
+}
+
+uint16_t HD44780::data(uint8_t value) {
+  if (_cgramSelected) {
+    _cgram[_address & 0x3F] = value;
+    _counters.glyphBytes++;
+  } else {
+    _ddram[_address & 0x7F] = value;
+    _counters.characters++;
+  }
+  advance();
+  _counters.busyUs += DATA_US;
+  return DATA_US;
+}
+
+void HD44780::advance() {
+  if (_cgramSelected) {
+    _address = (_address + (_increment ? 1 : 0x3F)) & 0x3F;
+  } else if (_twoLines) {
+    // The lines are 0x00-0x27 and 0x40-0x67, the counter jumps between them.
+    if (_increment) {
+      _address = (_address == 0x27) ? 0x40 : (_address == 0x67) ? 0x00 : _address + 1;
+    } else {
+      _address = (_address == 0x40) ? 0x27 : (_address == 0x00) ? 0x67 : _address - 1;
+    }
+  } else {
+    if (_increment) {
+      _address = (_address >= 0x4F) ? 0x00 : _address + 1;
+    } else {
+      _address = (_address == 0x00) ? 0x4F : _address - 1;
+    }
+  }
+}
+
+uint8_t HD44780::get_cellAddress(uint8_t column, uint8_t row) const {
+  const uint8_t rowAddress[4] = { 0x00, 0x40, _columns, (uint8_t)(0x40 + _columns) };
+  return rowAddress[row & 3] + column;
+}
+
+uint8_t HD44780::get_character(uint8_t column, uint8_t row) const {
+  return _ddram[get_cellAddress(column, row) & 0x7F];
+}
+
+std::string HD44780::get_row(uint8_t row) const {
+  std::string text;
+  for (uint8_t column = 0; column < _columns; column++) {
+    const uint8_t character = get_character(column, row);
+    // The codes 8 to 15 show the same glyphs as 0 to 7.
+    text += (char)((character < 16) ? (character & 7) : character);
+  }
+  return text;
+}
+
+uint8_t HD44780::get_glyphLine(uint8_t slot, uint8_t line) const {
+  return _cgram[((slot & 7) << 3) | (line & 7)];
+}
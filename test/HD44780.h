@@ -0,0 +1,122 @@
+/**
+@file
+Contains the HD44780 controller model used by the host tests and
+benchmarks.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+/// Counts of what was sent to an HD44780 controller.
+struct HD44780Counters {
+  uint32_t instructions; ///< Count of all instructions, including the ones below
+  uint32_t clears; ///< Count of the clear display and return home instructions
+  uint32_t addresses; ///< Count of the set DDRAM address instructions
+  uint32_t characters; ///< Count of the bytes written to DDRAM
+  uint32_t glyphBytes; ///< Count of the bytes written to CGRAM
+  uint32_t busyUs; ///< Time the controller was busy in microseconds
+
+  /// Returns the count of the bytes sent to the controller.
+  uint32_t bytes() const { return instructions + characters + glyphBytes; }
+};
+
+/// Model of an HD44780 controller.
+/**
+Executes the instructions and the data like the controller does. It keeps
+the DDRAM and the CGRAM, moves the address counter from one line to the
+next and returns how long every byte keeps the controller busy. The
+timings are the datasheet's for a 270 kHz oscillator.
+
+The simulated displays of the host tests drive it: `LiquidCrystal` byte by
+byte, the PCF8574 and parallel tests from the decoded bus signals.
+*/
+class HD44780 {
+public:
+  static const uint16_t CLEAR_US = 1520; ///< Clear display and return home
+  static const uint16_t EXECUTION_US = 37; ///< The other instructions
+  static const uint16_t DATA_US = 41; ///< Writing data, including the address update
+
+  /// The main constructor.
+  /**
+  @param columns - the visible columns
+  @param rows - the visible rows
+  */
+  HD44780(uint8_t columns = 16, uint8_t rows = 2);
+
+  /// Returns the controller to its state after power on and forgets the counts.
+  void reset();
+
+  /// Sets the visible size of the display.
+  /**
+  @param columns - the visible columns
+  @param rows - the visible rows
+  */
+  void set_size(uint8_t columns, uint8_t rows);
+
+  /// Executes an instruction.
+  /**
+  @param code - the instruction
+  @returns the time the controller is busy in microseconds
+  */
+  uint16_t instruction(uint8_t code);
+
+  /// Writes a byte to DDRAM or CGRAM at the address counter.
+  /**
+  @param value - the byte
+  @returns the time the controller is busy in microseconds
+  */
+  uint16_t data(uint8_t value);
+
+  /// Returns the address counter.
+  uint8_t get_address() const { return _address; }
+
+  /// Returns the DDRAM address of a visible cell.
+  /**
+  @param column - the column of the cell
+  @param row - the row of the cell
+  */
+  uint8_t get_cellAddress(uint8_t column, uint8_t row) const;
+
+  /// Returns the character shown in a cell.
+  /**
+  @param column - the column of the cell
+  @param row - the row of the cell
+  */
+  uint8_t get_character(uint8_t column, uint8_t row) const;
+
+  /// Returns the characters shown on a row.
+  /**
+  Glyphs are returned as their codes (0 to 7).
+
+  @param row - the row
+  */
+  std::string get_row(uint8_t row) const;
+
+  /// Returns a row of a glyph's bitmap.
+  /**
+  @param slot - the glyph's slot (0 to 7)
+  @param line - the row of the bitmap (0 to 7)
+  */
+  uint8_t get_glyphLine(uint8_t slot, uint8_t line) const;
+
+  /// Returns the counts of what was sent since the last reset.
+  const HD44780Counters& get_counters() const { return _counters; }
+
+  /// Sets the counts to 0.
+  void reset_counters();
+
+private:
+  /// Moves the address counter after a read or write.
+  void advance();
+
+  uint8_t _ddram[0x80]; ///< Display data RAM, only 80 bytes exist
+  uint8_t _cgram[64]; ///< Character generator RAM
+  uint8_t _address; ///< The address counter
+  bool _cgramSelected; ///< The address counter points into CGRAM
+  bool _increment; ///< Entry mode, the address counter is incremented
+  bool _twoLines; ///< Function set, two lines of 40 characters
+  uint8_t _columns, _rows; ///< The visible size
+  HD44780Counters _counters; ///< What was sent since the last reset
+};
@@ -0,0 +1,199 @@
+/**
+@file
+Contains the model of an HD44780 connected through its parallel pins.
+*/
+
+#pragma once
+
+#include <Arduino.h>
+
+#include "HD44780.h"
+
+/// Model of an HD44780 connected to the pins in 4-bit mode.
+/**
+Receives the pin operations of the host build (`host_setPins()`) and acts
+like the controller on its bus:
+- A nibble is latched from D4..D7 on the falling edge of E while R/W is
+  low, two nibbles make a byte after the initialization switched to 4-bit
+  mode.
+- While R/W is high the controller drives D4..D7 when E is high: the busy
+  flag and the high bits of the address counter, then the low bits.
+- A byte takes the controller's execution time, scaled by the speed of its
+  oscillator, during which the busy flag is set.
+
+It counts what a real display would get wrong: bytes latched while it was
+busy, nibbles latched from data pins which aren't outputs and the data
+pins driven by both sides. Every pin operation takes `pinUs`, like
+`digitalWrite()` on a 16 MHz AVR.
+*/
+class HD44780Pins : public HostPins {
+public:
+  /// The pin of R/W when it's connected to ground.
+  static const uint8_t NO_PIN = 0xFF;
+
+  /// How the busy flag reads.
+  enum class BusyFlag : uint8_t {
+    WORKING, ///< Set while the controller is busy
+    STUCK_BUSY, ///< D4..D7 read high, e.g. no display and pull-ups
+    STUCK_READY, ///< D7 reads low, e.g. a broken wire
+  };
+
+  /// The main constructor.
+  /**
+  @param rs - the pin connected to RS
+  @param rw - the pin connected to R/W or `NO_PIN`
+  @param enable - the pin connected to E
+  @param d4 - the pin connected to D4, D5..D7 follow it
+  */
+  HD44780Pins(uint8_t rs, uint8_t rw, uint8_t enable, uint8_t d4)
+    : _rsPin(rs), _rwPin(rw), _enablePin(enable), _d4Pin(d4) {
+    memset(_output, 0, sizeof(_output));
+    memset(_level, 0, sizeof(_level));
+  }
+
+  /// Forgets the errors and the timings.
+  void reset_counts() {
+    busyBytes = 0;
+    floatingNibbles = 0;
+    conflicts = 0;
+    reads = 0;
+    bytes = 0;
+    maxIdleUs = 0;
+  }
+
+  virtual void mode(uint8_t pin, uint8_t mode) {
+    host_advanceUs(pinUs);
+    _output[pin] = (mode == OUTPUT);
+    check_conflict();
+  }
+
+  virtual void write(uint8_t pin, uint8_t value) {
+    host_advanceUs(pinUs);
+    const bool wasHigh = _level[pin];
+    _level[pin] = (value != LOW);
+    if ((pin == _enablePin) && (wasHigh != _level[pin])) {
+      if (is_reading()) {
+        if (_level[pin]) {
+          drive_nibble();
+        } else {
+          _readLow = !_readLow;
+        }
+      } else if (!_level[pin]) {
+        latch_nibble();
+      }
+    }
+    check_conflict();
+  }
+
+  virtual int read(uint8_t pin) {
+    host_advanceUs(pinUs);
+    const bool isData = (pin >= _d4Pin) && (pin < _d4Pin + 4);
+    if (isData && is_driving() && !_output[pin]) {
+      return (_driven >> (pin - _d4Pin)) & 1;
+    }
+    return _level[pin] ? HIGH : LOW;
+  }
+
+  /// Returns true while the controller executes the last byte.
+  bool is_busy() const {
+    return (int32_t)(host_nowUs() - _readyUs) < 0;
+  }
+
+  HD44780 controller{ 16, 2 }; ///< The controller's memory and instructions
+  uint16_t executionPercent = 100; ///< Speed of the oscillator, 100 for 270 kHz
+  uint8_t pinUs = 3; ///< Duration of a pin operation in microseconds
+  BusyFlag busyFlag = BusyFlag::WORKING; ///< How the busy flag reads
+
+  uint32_t bytes = 0; ///< Count of the received bytes
+  uint32_t busyBytes = 0; ///< Count of the bytes latched while busy
+  uint32_t floatingNibbles = 0; ///< Count of the nibbles latched from inputs
+  uint32_t conflicts = 0; ///< Count of the data pins driven by both sides
+  uint32_t reads = 0; ///< Count of the busy flag reads
+  uint32_t maxIdleUs = 0; ///< Longest time ready before a byte arrived
+
+private:
+  /// Returns true if R/W is high.
+  bool is_reading() const {
+    return (_rwPin != NO_PIN) && _level[_rwPin];
+  }
+
+  /// Returns true if the controller drives the data pins.
+  bool is_driving() const {
+    return is_reading() && _level[_enablePin];
+  }
+
+  /// Puts the busy flag and the address counter on the data pins.
+  void drive_nibble() {
+    const uint8_t value = (is_busy() ? 0x80 : 0) | (controller.get_address() & 0x7F);
+    _driven = _readLow ? (value & 0x0F) : (value >> 4);
+    if (busyFlag == BusyFlag::STUCK_BUSY) {
+      _driven = 0x0F;
+    } else if (busyFlag == BusyFlag::STUCK_READY) {
+      _driven &= 0x07;
+    }
+    if (!_readLow) {
+      reads++;
+    }
+    check_conflict();
+  }
+
+  /// Counts the data pins which are outputs while the controller drives them.
+  void check_conflict() {
+    if (!is_driving()) {
+      return;
+    }
+    for (uint8_t i = 0; i < 4; i++) {
+      if (_output[_d4Pin + i]) {
+        conflicts++;
+      }
+    }
+  }
+
+  /// Latches the nibble on the data pins.
+  void latch_nibble() {
+    uint8_t nibble = 0;
+    for (uint8_t i = 0; i < 4; i++) {
+      if (!_output[_d4Pin + i]) {
+        floatingNibbles++;
+      }
+      nibble |= _level[_d4Pin + i] << i;
+    }
+    if (!_fourBit) {
+      // Every nibble is a whole instruction in 8-bit mode.
+      execute(nibble << 4, false);
+      _fourBit = (nibble == 0x2);
+      return;
+    }
+    if (!_writeLow) {
+      _high = nibble << 4;
+      _writeLow = true;
+      return;
+    }
+    _writeLow = false;
+    execute(_high | nibble, _level[_rsPin]);
+  }
+
+  /// Executes a byte and sets the busy flag for its execution time.
+  void execute(uint8_t value, bool isData) {
+    const uint32_t now = host_nowUs();
+    if (is_busy()) {
+      busyBytes++;
+    } else if ((bytes > 0) && (now - _readyUs > maxIdleUs)) {
+      maxIdleUs = now - _readyUs;
+    }
+    bytes++;
+    const uint16_t executionUs = isData ? controller.data(value)
+                                        : controller.instruction(value);
+    _readyUs = now + (uint32_t)executionUs * 100 / executionPercent;
+  }
+
+  uint8_t _rsPin, _rwPin, _enablePin, _d4Pin;
+  bool _output[256]; ///< The pins which are outputs of the microcontroller
+  bool _level[256]; ///< The levels written to the pins
+  bool _fourBit = false; ///< The initialization switched to 4-bit mode
+  bool _writeLow = false; ///< The next latched nibble is the low one
+  bool _readLow = false; ///< The next read nibble is the low one
+  uint8_t _high = 0; ///< The high nibble of the byte being written
+  uint8_t _driven = 0; ///< The nibble driven on the data pins
+  uint32_t _readyUs = 0; ///< When the controller finishes the last byte
+};
@@ -0,0 +1,293 @@
+/**
+@file
+Benchmark of merging nearby runs on sequences of frames.
+
+Every sequence changes the values of a screen frame by frame, like a
+sketch would, and is rendered with `softUpdate()` once per pair of costs
+given to the menu (`get_cursorCost()`, `get_characterCost()`). The pair
+decides the longest gap of unchanged characters that is rewritten to join
+two runs, `(cursorCost - 1) / characterCost`, a gap of 0 is rendering
+without merging. Every sequence is sent to a parallel HD44780 and to a
+PCF8574 backpack, so the pairs are compared on the bytes and the bus time
+of both. The counts and the times are simulated and repeatable.
+*/
+
+#include <stdio.h>
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+#include <LiquidPCF8574.h>
+
+/// The I2C clock the PCF8574 bus time is computed for.
+const uint32_t I2C_HZ = 100000;
+
+/// Forwards to another driver with the costs set by the benchmark.
+class CostDriver : public LiquidDisplayDriver {
+public:
+  /// Sets the driver the commands are sent to.
+  void set_driver(LiquidDisplayDriver &driver) {
+    _p_driver = &driver;
+  }
+
+  /// Sets the costs the menu is told.
+  void set_costs(uint8_t cursorCost, uint8_t characterCost) {
+    _cursorCost = cursorCost;
+    _characterCost = characterCost;
+  }
+
+  virtual void clear() {
+    _p_driver->clear();
+  }
+
+  virtual void setCursor(uint8_t column, uint8_t row) {
+    _p_driver->setCursor(column, row);
+  }
+
+  virtual void write(uint8_t character) {
+    _p_driver->write(character);
+  }
+
+  virtual void write(const uint8_t *buffer, uint8_t size) {
+    _p_driver->write(buffer, size);
+  }
+
+  virtual void write_at(uint8_t column, uint8_t row,
+                        const uint8_t *buffer, uint8_t size) {
+    _p_driver->write_at(column, row, buffer, size);
+  }
+
+  virtual uint8_t get_cursorCost() const {
+    return _cursorCost;
+  }
+
+  virtual uint8_t get_characterCost() const {
+    return _characterCost;
+  }
+
+  virtual void createChar(uint8_t index, uint8_t glyph[8]) {
+    _p_driver->createChar(index, glyph);
+  }
+
+private:
+  LiquidDisplayDriver *_p_driver = nullptr;
+  uint8_t _cursorCost = 1;
+  uint8_t _characterCost = 1;
+};
+
+/// A pair of costs.
+struct Costs {
+  uint8_t cursor;
+  uint8_t character;
+};
+
+/// The compared pairs, the first one doesn't merge.
+const Costs COSTS[] = { {1, 1}, {2, 1}, {3, 1}, {4, 1}, {7, 4}, {8, 1}, {7, 2} };
+
+/// How many frames every sequence has.
+const uint16_t FRAMES = 500;
+
+/// A repeatable pseudo-random number.
+static uint32_t random_state = 1;
+
+static uint16_t next_random() {
+  random_state = random_state * 1103515245 + 12345;
+  return (random_state >> 16) & 0x7FFF;
+}
+
+LiquidCrystal parallel_lcd(12, 11, 5, 4, 3, 2);
+LiquidPCF8574 pcf8574_lcd(0x27);
+auto parallel_driver = make_liquidDriver(parallel_lcd);
+auto pcf8574_driver = make_liquidDriver(pcf8574_lcd);
+CostDriver cost_driver;
+
+/// A sequence of frames.
+struct Sequence {
+  const char *name;
+  LiquidMenu *p_menu;
+  void (*start)(); ///< Sets the first frame
+  void (*step)(uint16_t frame); ///< Changes the values for the next frame
+};
+
+/// Totals of a sequence rendered with one pair of costs.
+struct Totals {
+  uint32_t bytes;
+  uint32_t busUs;
+  uint32_t transmissions;
+  uint32_t cursorMoves;
+  uint32_t rewrites;
+};
+
+/// Renders the frames of a sequence on one display.
+static Totals render(const Sequence &sequence, bool pcf8574) {
+  LiquidMenu &menu = *sequence.p_menu;
+  sequence.start();
+  // A full redraw, so that every pair starts from the same display.
+  menu.update();
+  parallel_lcd.controller.reset_counters();
+  Wire.reset();
+  menu.reset_stats();
+  const uint32_t startUs = micros();
+  for (uint16_t frame = 0; frame < FRAMES; frame++) {
+    sequence.step(frame);
+    menu.softUpdate();
+  }
+  Totals totals;
+  if (pcf8574) {
+    totals.bytes = Wire.get_byteCount();
+    totals.busUs = (uint64_t)Wire.get_bitCount() * 1000000 / I2C_HZ;
+    totals.transmissions = Wire.transmissions.size();
+  } else {
+    totals.bytes = parallel_lcd.controller.get_counters().bytes();
+    totals.busUs = micros() - startUs;
+    totals.transmissions = 0;
+  }
+  totals.cursorMoves = menu.get_stats().cursorMoves;
+  totals.rewrites = menu.get_stats().rewrites;
+  return totals;
+}
+
+/// Prints the totals of every pair of costs, relative to not merging.
+static void bench(const Sequence &sequence, bool pcf8574) {
+  printf("\n%s, %s, %u frames\n", sequence.name,
+         pcf8574 ? "PCF8574 at 100 kHz" : "parallel HD44780", FRAMES);
+  printf("%-7s %4s %8s %8s %8s %8s %10s %7s\n", "costs", "gap", "cursor",
+         "rewrite", "xfers", "bytes", "bus us", "time");
+  cost_driver.set_driver(pcf8574 ? (LiquidDisplayDriver&)pcf8574_driver
+                                 : (LiquidDisplayDriver&)parallel_driver);
+  uint32_t baseUs = 0;
+  for (const Costs &costs : COSTS) {
+    cost_driver.set_costs(costs.cursor, costs.character);
+    const Totals totals = render(sequence, pcf8574);
+    if (baseUs == 0) {
+      baseUs = totals.busUs;
+    }
+    char name[8];
+    snprintf(name, sizeof(name), "%u/%u", costs.cursor, costs.character);
+    printf("%-7s %4u %8u %8u %8u %8u %10u %6.1f%%\n", name,
+           (costs.cursor - 1) / costs.character, totals.cursorMoves,
+           totals.rewrites, totals.transmissions, totals.bytes, totals.busUs,
+           100.0 * totals.busUs / baseUs);
+  }
+}
+
+
+// "clock": a clock and a date ticking every frame, 20x4.
+uint8_t hours = 9;
+uint8_t minutes = 59;
+uint8_t seconds = 0;
+char clock_text[12] = "09:59:00";
+uint16_t day = 1;
+
+LiquidLine clock_line(4, 0, clock_text);
+LiquidLine day_line(0, 1, "Day ", day, " of 365");
+LiquidScreen clock_screen(clock_line, day_line);
+LiquidMenu clock_menu(cost_driver, clock_screen);
+
+static void clock_print() {
+  snprintf(clock_text, sizeof(clock_text), "%02u:%02u:%02u", hours, minutes, seconds);
+}
+
+static void clock_start() {
+  hours = 9;
+  minutes = 59;
+  seconds = 0;
+  day = 1;
+  clock_print();
+}
+
+static void clock_step(uint16_t) {
+  // A minute passes every frame, so that the digits around the colons
+  // change together.
+  seconds = (seconds + 7) % 60;
+  if (++minutes == 60) {
+    minutes = 0;
+    if (++hours == 24) {
+      hours = 0;
+      day++;
+    }
+  }
+  clock_print();
+}
+
+
+// "sensors": four readings drifting at random, 20x4.
+float temperature = 21.5f;
+float humidity = 48.0f;
+uint16_t pressure = 1013;
+uint32_t uptime = 0;
+
+LiquidLine temperature_line(0, 0, "Temperature: ", temperature, "C");
+LiquidLine humidity_line(0, 1, "Humidity: ", humidity, "%");
+LiquidLine pressure_line(0, 2, "Pressure: ", pressure, "hPa");
+LiquidLine uptime_line(0, 3, "Uptime: ", uptime, "s");
+LiquidScreen sensors_screen(temperature_line, humidity_line, pressure_line, uptime_line);
+LiquidMenu sensors_menu(cost_driver, sensors_screen);
+
+static void sensors_start() {
+  random_state = 1;
+  temperature = 21.5f;
+  humidity = 48.0f;
+  pressure = 1013;
+  uptime = 0;
+}
+
+static void sensors_step(uint16_t) {
+  temperature += (int16_t)(next_random() % 5 - 2) / 10.0f;
+  humidity += (int16_t)(next_random() % 3 - 1);
+  pressure += (int16_t)(next_random() % 3 - 1);
+  uptime += 3;
+}
+
+
+// "scattered": characters of a 20x4 screen changing at random positions.
+char scattered_rows[4][21];
+
+LiquidLine scattered_line1(0, 0, scattered_rows[0]);
+LiquidLine scattered_line2(0, 1, scattered_rows[1]);
+LiquidLine scattered_line3(0, 2, scattered_rows[2]);
+LiquidLine scattered_line4(0, 3, scattered_rows[3]);
+LiquidScreen scattered_screen(scattered_line1, scattered_line2,
+                              scattered_line3, scattered_line4);
+LiquidMenu scattered_menu(cost_driver, scattered_screen);
+
+static void scattered_start() {
+  random_state = 1;
+  for (uint8_t r = 0; r < 4; r++) {
+    memset(scattered_rows[r], '.', 20);
+    scattered_rows[r][20] = '\0';
+  }
+}
+
+static void scattered_step(uint16_t) {
+  for (uint8_t i = 0; i < 6; i++) {
+    const uint16_t cell = next_random() % 80;
+    char &character = scattered_rows[cell / 20][cell % 20];
+    character = (character == '.') ? '#' : '.';
+  }
+}
+
+
+int main() {
+  printf("LiquidMenu %s - merging nearby runs on sequences of frames\n",
+         LIQUIDMENU_VERSION);
+  printf("costs: cursor/character given to the menu, gap: the most rewritten "
+         "unchanged characters,\ntime: bus time relative to not merging "
+         "(1/1)\n");
+
+  parallel_lcd.begin(20, 4);
+  pcf8574_lcd.begin(20, 4);
+
+  const Sequence sequences[] = {
+    { "clock 20x4", &clock_menu, clock_start, clock_step },
+    { "sensors 20x4", &sensors_menu, sensors_start, sensors_step },
+    { "scattered 20x4", &scattered_menu, scattered_start, scattered_step },
+  };
+  for (const Sequence &sequence : sequences) {
+    sequence.p_menu->set_displaySize(20, 4);
+    sequence.p_menu->set_clearOnUpdate(false);
+    sequence.p_menu->init();
+    bench(sequence, false);
+    bench(sequence, true);
+  }
+  return 0;
+}
@@ -0,0 +1,340 @@
+/**
+@file
+Benchmark of the menu operations on a simulated HD44780 display.
+
+The menus are modelled on the examples, every one is built in its own
+function, so that the lines release their slots before the next one. Every
+operation is repeated and
+the average bytes, instructions, cursor positionings, characters, clears
+and glyph uploads it sends to the display are printed, together with the
+time the display is busy with them (simulated bus time) and the time the
+host's CPU spends in the library and the model (CPU time). The counts and
+the bus time are exact and repeatable, compare them before and after a
+change to find regressions in the render cost.
+*/
+
+#include <stdio.h>
+#include <chrono>
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+/// How many times every operation is repeated.
+const uint8_t REPETITIONS = 50;
+
+/// The display the current operation is measured on.
+static LiquidCrystal *p_lcd = nullptr;
+
+/// The menu the current operations are called on.
+static LiquidMenu *p_menu = nullptr;
+
+/// The menu system the current operations are called on.
+static LiquidSystem *p_system = nullptr;
+
+/// Prints the title and the header of a table of operations.
+static void print_table(const char *title) {
+  printf("\n%s\n", title);
+  printf("%-16s %7s %7s %7s %7s %7s %7s %9s %9s\n", "operation", "bytes",
+         "instr", "cursor", "chars", "clears", "glyphs", "bus us", "cpu us");
+}
+
+/// Repeats an operation and prints the averages per repetition.
+static void measure(const char *name, void (*operation)()) {
+  p_lcd->controller.reset_counters();
+  const uint32_t startUs = micros();
+  const auto start = std::chrono::steady_clock::now();
+  for (uint8_t i = 0; i < REPETITIONS; i++) {
+    operation();
+  }
+  const std::chrono::duration<double, std::micro> cpu =
+    std::chrono::steady_clock::now() - start;
+  const uint32_t busUs = micros() - startUs;
+
+  const HD44780Counters &counters = p_lcd->controller.get_counters();
+  const double n = REPETITIONS;
+  printf("%-16s %7.1f %7.1f %7.1f %7.1f %7.2f %7.2f %9.1f %9.2f\n", name,
+         counters.bytes() / n, counters.instructions / n,
+         counters.addresses / n, counters.characters / n, counters.clears / n,
+         counters.glyphBytes / 8 / n, busUs / n, cpu.count() / n);
+}
+
+
+static void blank_function() {}
+
+static void menu_update() { p_menu->update(); }
+
+static void menu_softUpdate() { p_menu->softUpdate(); }
+
+static void menu_nextScreen() { p_menu->next_screen(); }
+
+static void menu_switchFocus() { p_menu->switch_focus(); }
+
+static void menu_callFunction() { p_menu->call_function(1); }
+
+
+// "buttons_menu": a welcome screen, a status screen and a screen with a
+// function, 16x2.
+LiquidCrystal buttons_lcd(12, 11, 5, 4, 3, 2);
+
+unsigned short analogValue = 512;
+char ledState_text[4] = "OFF";
+uint8_t pwmLevel = 0;
+
+static void pwm_up() {
+  pwmLevel += 25;
+}
+
+static void buttons_softUpdate() {
+  analogValue++;
+  p_menu->softUpdate();
+}
+
+static void bench_buttons() {
+  LiquidLine welcome_line1(1, 0, "LiquidMenu ", LIQUIDMENU_VERSION);
+  LiquidLine welcome_line2(0, 1, "Benchmark");
+  LiquidScreen welcome_screen(welcome_line1, welcome_line2);
+
+  LiquidLine analog_line(0, 0, "Analog: ", analogValue);
+  LiquidLine ledState_line(0, 1, "LED is ", ledState_text);
+  LiquidScreen status_screen(analog_line, ledState_line);
+
+  LiquidLine pwm_line(0, 0, "PWM level: ", pwmLevel);
+  LiquidLine back_line(0, 1, "/BACK");
+  LiquidScreen pwm_screen(pwm_line, back_line);
+
+  LiquidMenu buttons_menu(buttons_lcd, welcome_screen, status_screen, pwm_screen);
+  p_lcd = &buttons_lcd;
+  p_menu = &buttons_menu;
+
+  buttons_lcd.begin(16, 2);
+  buttons_menu.set_displaySize(16, 2);
+  pwm_line.attach_function(1, pwm_up);
+  back_line.attach_function(1, blank_function);
+  buttons_menu.init();
+
+  const bool clearModes[] = { true, false };
+  for (bool clearOnUpdate : clearModes) {
+    buttons_menu.set_clearOnUpdate(clearOnUpdate);
+    print_table(clearOnUpdate ? "buttons_menu 16x2, clearing on update"
+                              : "buttons_menu 16x2, overwriting on update");
+
+    buttons_menu.change_screen(&status_screen);
+    measure("update", menu_update);
+    measure("softUpdate", buttons_softUpdate);
+    measure("next_screen", menu_nextScreen);
+
+    buttons_menu.change_screen(&pwm_screen);
+    measure("switch_focus", menu_switchFocus);
+    buttons_menu.set_focusedLine(0);
+    measure("call_function", menu_callFunction);
+  }
+}
+
+
+// "scrolling_menu": five focusable lines scrolled on two rows, 16x2.
+LiquidCrystal scrolling_lcd(12, 11, 5, 4, 3, 2);
+
+const float pi = 3.14159265f;
+
+static void bench_scrolling() {
+  LiquidLine scrolling_line1(0, 0, pi);
+  LiquidLine scrolling_line2(0, 1, "Line 2");
+  LiquidLine scrolling_line3(0, 1, "Line 3");
+  LiquidLine scrolling_line4(0, 1, "Line 4");
+  LiquidLine scrolling_line5(0, 1, "Line 5");
+  LiquidScreen scrolling_screen;
+
+  LiquidMenu scrolling_menu(scrolling_lcd);
+  p_lcd = &scrolling_lcd;
+  p_menu = &scrolling_menu;
+
+  scrolling_lcd.begin(16, 2);
+  scrolling_menu.set_displaySize(16, 2);
+  scrolling_screen.add_line(scrolling_line1);
+  scrolling_screen.add_line(scrolling_line2);
+  scrolling_screen.add_line(scrolling_line3);
+  scrolling_screen.add_line(scrolling_line4);
+  scrolling_screen.add_line(scrolling_line5);
+  scrolling_line1.attach_function(1, blank_function);
+  scrolling_line2.attach_function(1, blank_function);
+  scrolling_line3.attach_function(1, blank_function);
+  scrolling_line4.attach_function(1, blank_function);
+  scrolling_line5.attach_function(1, blank_function);
+  scrolling_screen.set_displayLineCount(2);
+  scrolling_menu.add_screen(scrolling_screen);
+  scrolling_menu.init();
+  scrolling_menu.update();
+
+  print_table("scrolling_menu 16x2");
+  measure("switch_focus", menu_switchFocus);
+  measure("update", menu_update);
+}
+
+
+// "getters_menu": values read through getter functions, 16x2.
+LiquidCrystal getters_lcd(12, 11, 5, 4, 3, 2);
+
+int potValue = 100;
+
+int read_pot() {
+  return potValue;
+}
+
+const char* get_potPosition() {
+  return (potValue < 512) ? "low" : "high";
+}
+
+static void getters_refreshUnchanged() { p_menu->refresh_getters(); }
+
+static void getters_refreshChanged() {
+  potValue += 7;
+  p_menu->refresh_getters();
+}
+
+static void bench_getters() {
+  LiquidLine potValue_line(0, 0, "Value: ", read_pot);
+  LiquidLine potPosition_line(0, 1, get_potPosition);
+  // The getters are kept, so that unchanged values aren't redrawn.
+  potValue_line.set_getterInterval(0);
+  potPosition_line.set_getterInterval(0);
+  LiquidScreen pot_screen(potValue_line, potPosition_line);
+
+  LiquidMenu getters_menu(getters_lcd, pot_screen);
+  p_lcd = &getters_lcd;
+  p_menu = &getters_menu;
+
+  getters_lcd.begin(16, 2);
+  getters_menu.set_displaySize(16, 2);
+  getters_menu.init();
+  getters_menu.update();
+
+  print_table("getters_menu 16x2");
+  measure("refresh (same)", getters_refreshUnchanged);
+  measure("refresh (new)", getters_refreshChanged);
+  measure("softUpdate", menu_softUpdate);
+}
+
+
+// "sensors": a 20x4 status screen where one value changes at a time.
+LiquidCrystal sensors_lcd(12, 11, 5, 4, 3, 2);
+
+float temperature = 21.5f;
+float humidity = 48.0f;
+uint16_t pressure = 1013;
+uint32_t uptime = 0;
+
+/// The line refreshed by `sensors_refreshLine()`.
+static LiquidLine *p_temperatureLine = nullptr;
+
+static void sensors_softUpdate() {
+  uptime++;
+  p_menu->softUpdate();
+}
+
+static void sensors_refreshLine() {
+  temperature += 0.1f;
+  p_menu->refresh_line(*p_temperatureLine);
+}
+
+static void bench_sensors() {
+  LiquidLine temperature_line(0, 0, "Temperature: ", temperature, "C");
+  LiquidLine humidity_line(0, 1, "Humidity: ", humidity, "%");
+  LiquidLine pressure_line(0, 2, "Pressure: ", pressure, "hPa");
+  LiquidLine uptime_line(0, 3, "Uptime: ", uptime, "s");
+  LiquidScreen sensors_screen(temperature_line, humidity_line, pressure_line, uptime_line);
+
+  LiquidMenu sensors_menu(sensors_lcd, sensors_screen);
+  p_lcd = &sensors_lcd;
+  p_menu = &sensors_menu;
+  p_temperatureLine = &temperature_line;
+
+  sensors_lcd.begin(20, 4);
+  sensors_menu.set_displaySize(20, 4);
+  sensors_menu.set_clearOnUpdate(false);
+  temperature_line.set_decimalPlaces(1);
+  humidity_line.set_decimalPlaces(0);
+  sensors_menu.init();
+  sensors_menu.update();
+
+  print_table("sensors 20x4");
+  measure("update", menu_update);
+  measure("softUpdate", sensors_softUpdate);
+  measure("refresh_line", sensors_refreshLine);
+}
+
+
+// "system_menu": three menus on one display switched by a LiquidSystem, 16x2.
+LiquidCrystal system_lcd(12, 11, 5, 4, 3, 2);
+
+uint8_t pin6_level = 0;
+uint8_t pinA4_value = 0;
+uint8_t pinA5_value = 0;
+
+/// The menus switched between by `system_changeMenu()`.
+static LiquidMenuBase *p_systemMenus[4];
+
+static void system_changeMenu() {
+  static uint8_t next = 0;
+  p_system->change_menu(*p_systemMenus[next]);
+  next = (next + 1) % 4;
+}
+
+static void system_switchFocus() { p_system->switch_focus(); }
+
+static void bench_system() {
+  LiquidLine outputs_line(0, 0, "/Outputs");
+  LiquidLine inputs_line(0, 1, "/Inputs");
+  LiquidScreen io_screen(outputs_line, inputs_line);
+  LiquidMenu main_menu(system_lcd, io_screen);
+
+  LiquidLine pin6_line(0, 0, "Pin 6: ", pin6_level);
+  LiquidScreen pin6_screen(pin6_line);
+  LiquidMenu outputs_menu(system_lcd, pin6_screen);
+
+  LiquidLine pinA4_line(0, 0, "Pin A4: ", pinA4_value);
+  LiquidLine pinA5_line(0, 1, "Pin A5: ", pinA5_value);
+  LiquidScreen pinsA4_A5_screen(pinA4_line, pinA5_line);
+  LiquidMenu inputs_menu(system_lcd, pinsA4_A5_screen);
+
+  LiquidSystem menu_system(main_menu, outputs_menu, inputs_menu);
+  p_lcd = &system_lcd;
+  p_system = &menu_system;
+  p_systemMenus[0] = &outputs_menu;
+  p_systemMenus[1] = &main_menu;
+  p_systemMenus[2] = &inputs_menu;
+  p_systemMenus[3] = &main_menu;
+
+  system_lcd.begin(16, 2);
+  menu_system.set_displaySize(16, 2);
+  outputs_line.attach_function(1, blank_function);
+  inputs_line.attach_function(1, blank_function);
+  pin6_line.attach_function(1, blank_function);
+  pinA4_line.attach_function(1, blank_function);
+  menu_system.update();
+
+  print_table("system_menu 16x2");
+  measure("change_menu", system_changeMenu);
+  menu_system.change_menu(main_menu);
+  measure("switch_focus", system_switchFocus);
+}
+
+
+int main() {
+  printf("LiquidMenu %s - benchmark on a simulated HD44780\n", LIQUIDMENU_VERSION);
+  printf("Instruction %u us, data %u us, clear %u us, %u repetitions, "
+         "averages per repetition\n", HD44780::EXECUTION_US, HD44780::DATA_US,
+         HD44780::CLEAR_US, REPETITIONS);
+
+  bench_buttons();
+  bench_scrolling();
+  bench_getters();
+  bench_sensors();
+  bench_system();
+
+  if (LiquidLineBase::get_missingSlots() > 0) {
+    printf("\n%u line slots were missing, raise MAX_LINE_SLOTS\n",
+           LiquidLineBase::get_missingSlots());
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,95 @@
+/**
+@file
+Minimal checks for the host tests.
+
+A failed check prints where it failed and the test continues, `main()`
+returns `check_result()` so that `make check` stops on a failure.
+*/
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/// Count of the failed checks.
+static unsigned checkFailures = 0;
+
+/// Count of all checks.
+static unsigned checkCount = 0;
+
+/// Checks a condition.
+#define CHECK(condition) check_true((condition), #condition, __FILE__, __LINE__)
+
+/// Checks that two values are equal, the values are printed when they aren't.
+#define CHECK_EQUAL(expected, actual) \
+  check_equal((expected), (actual), #actual, __FILE__, __LINE__)
+
+static inline void check_true(bool passed, const char *expression,
+                              const char *file, int line) {
+  checkCount++;
+  if (!passed) {
+    checkFailures++;
+    printf("%s:%d: check failed: %s\n", file, line, expression);
+  }
+}
+
+static inline std::string check_format(long long value) {
+  return std::to_string(value);
+}
+
+static inline std::string check_format(const std::string &value) {
+  std::string text = "\"";
+  for (unsigned char character : value) {
+    if ((character < 0x20) || (character > 0x7E)) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\x%02X", character);
+      text += escaped;
+    } else {
+      text += (char)character;
+    }
+  }
+  return text + "\"";
+}
+
+static inline std::string check_format(const std::vector<uint8_t> &value) {
+  std::string text = "{";
+  for (size_t i = 0; i < value.size(); i++) {
+    char hex[8];
+    snprintf(hex, sizeof(hex), "%s%02X", i ? " " : "", value[i]);
+    text += hex;
+  }
+  return text + "}";
+}
+
+template <typename T>
+static inline void check_equal(const T &expected, const T &actual,
+                               const char *expression, const char *file, int line) {
+  checkCount++;
+  if (!(expected == actual)) {
+    checkFailures++;
+    printf("%s:%d: %s\n  expected %s\n  actual   %s\n", file, line, expression,
+           check_format(expected).c_str(), check_format(actual).c_str());
+  }
+}
+
+static inline void check_equal(long long expected, long long actual,
+                               const char *expression, const char *file, int line) {
+  check_equal<long long>(expected, actual, expression, file, line);
+}
+
+static inline void check_equal(const char *expected, const std::string &actual,
+                               const char *expression, const char *file, int line) {
+  check_equal<std::string>(std::string(expected), actual, expression, file, line);
+}
+
+/// Prints the summary of the checks.
+/**
+@param *name - the name of the test
+@returns the exit code of the test, 0 if all checks passed
+*/
+static inline int check_result(const char *name) {
+  printf("%s: %u checks, %u failed\n", name, checkCount, checkFailures);
+  return (checkFailures == 0) ? 0 : 1;
+}
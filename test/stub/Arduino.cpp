@@ -0,0 +1,69 @@
+/**
+@file
+Definitions of the host stand-ins for the Arduino core.
+*/
+
+#include "Arduino.h"
+
+/// The simulated clock in microseconds.
+static uint64_t clockUs = 0;
+
+/// How long a call to `micros()` takes.
+static uint32_t microsCostUs = 0;
+
+/// The simulated device connected to the pins.
+static HostPins *p_hostPins = nullptr;
+
+unsigned long millis() {
+  return (uint32_t)(clockUs / 1000);
+}
+
+unsigned long micros() {
+  const uint32_t now = clockUs;
+  clockUs += microsCostUs;
+  return now;
+}
+
+void delay(unsigned long ms) {
+  clockUs += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+  clockUs += us;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (p_hostPins != nullptr) {
+    p_hostPins->mode(pin, mode);
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  if (p_hostPins != nullptr) {
+    p_hostPins->write(pin, value);
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  return (p_hostPins != nullptr) ? p_hostPins->read(pin) : LOW;
+}
+
+void host_advanceUs(uint32_t us) {
+  clockUs += us;
+}
+
+void host_resetClock() {
+  clockUs = 0;
+}
+
+uint32_t host_nowUs() {
+  return (uint32_t)clockUs;
+}
+
+void host_setMicrosCost(uint32_t us) {
+  microsCostUs = us;
+}
+
+void host_setPins(HostPins *p_pins) {
+  p_hostPins = p_pins;
+}
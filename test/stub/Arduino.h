@@ -0,0 +1,80 @@
+/**
+@file
+Host stand-in for the Arduino core's `Arduino.h`.
+
+The clock doesn't follow the wall time, it advances only through
+`delay()`, `delayMicroseconds()` and `host_advanceUs()`. The simulated
+displays advance it by the time the display is busy, so the durations
+measured by the library are the simulated bus time and the results are
+repeatable. Like on the target, `millis()` and `micros()` wrap around at 32
+bits.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include "avr/pgmspace.h"
+#include "WString.h"
+#include "Print.h"
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+/// @name Host simulation
+///@{
+
+/// Advances the simulated clock.
+/**
+@param us - microseconds
+*/
+void host_advanceUs(uint32_t us);
+
+/// Sets the simulated clock back to 0.
+void host_resetClock();
+
+/// Returns the simulated clock, without the cost of `micros()`.
+uint32_t host_nowUs();
+
+/// Sets how long a call to `micros()` takes.
+/**
+Loops waiting for `micros()` to reach a time need the clock to advance
+while they wait, like on the target.
+
+@param us - microseconds, 0 by default
+*/
+void host_setMicrosCost(uint32_t us);
+
+/// Receives the pin operations, e.g. a simulated display.
+class HostPins {
+public:
+  virtual ~HostPins() {}
+  virtual void mode(uint8_t pin, uint8_t mode) = 0;
+  virtual void write(uint8_t pin, uint8_t value) = 0;
+  virtual int read(uint8_t pin) = 0;
+};
+
+/// Connects the pins to a simulated device.
+/**
+@param *p_pins - the device, nullptr for none (default)
+*/
+void host_setPins(HostPins *p_pins);
+///@}
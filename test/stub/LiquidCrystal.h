@@ -0,0 +1,77 @@
+/**
+@file
+Host stand-in for Arduino's `LiquidCrystal` library.
+
+Has the same methods as the library, but sends the bytes to an HD44780
+model instead of the pins. Every byte advances the clock by the time it
+keeps the controller busy. The model is public, the tests and benchmarks
+read the display's contents and the counts from it.
+*/
+
+#pragma once
+
+#include "Arduino.h"
+#include "HD44780.h"
+
+class LiquidCrystal : public Print {
+public:
+  LiquidCrystal(uint8_t rs, uint8_t enable,
+                uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7) {
+    (void)rs; (void)enable; (void)d4; (void)d5; (void)d6; (void)d7;
+  }
+
+  LiquidCrystal(uint8_t rs, uint8_t rw, uint8_t enable,
+                uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7) {
+    (void)rs; (void)rw; (void)enable; (void)d4; (void)d5; (void)d6; (void)d7;
+  }
+
+  void begin(uint8_t columns, uint8_t rows) {
+    _columns = columns;
+    _rows = rows;
+    controller.reset();
+    controller.set_size(columns, rows);
+    command((rows > 1) ? 0x28 : 0x20);
+    command(0x0C);
+    clear();
+    command(0x06);
+    controller.reset_counters();
+  }
+
+  void clear() { command(0x01); }
+
+  void home() { command(0x02); }
+
+  void setCursor(uint8_t column, uint8_t row) {
+    const uint8_t rowAddress[4] = { 0x00, 0x40, _columns, (uint8_t)(0x40 + _columns) };
+    if (row >= 4) {
+      row = 3;
+    }
+    if (row >= _rows) {
+      row = _rows - 1;
+    }
+    command(0x80 | (column + rowAddress[row]));
+  }
+
+  void createChar(uint8_t location, uint8_t charmap[]) {
+    command(0x40 | ((location & 7) << 3));
+    for (uint8_t i = 0; i < 8; i++) {
+      write(charmap[i]);
+    }
+  }
+
+  void command(uint8_t value) {
+    host_advanceUs(controller.instruction(value));
+  }
+
+  virtual size_t write(uint8_t value) {
+    host_advanceUs(controller.data(value));
+    return 1;
+  }
+
+  using Print::write;
+
+  HD44780 controller; ///< The simulated controller
+
+private:
+  uint8_t _columns = 16, _rows = 2;
+};
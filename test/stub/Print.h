@@ -0,0 +1,122 @@
+/**
+@file
+Host stand-in for the Arduino core's `Print.h`.
+
+Formats numbers the same way as the Arduino core, so the text sent to the
+simulated displays matches the one on the target.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <math.h>
+#include "WString.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t character) = 0;
+
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+      if (write(*buffer++) == 0) {
+        break;
+      }
+      n++;
+    }
+    return n;
+  }
+
+  size_t write(const char *text) {
+    return (text == nullptr) ? 0 : write((const uint8_t *)text, strlen(text));
+  }
+
+  size_t write(const char *buffer, size_t size) {
+    return write((const uint8_t *)buffer, size);
+  }
+
+  size_t print(const __FlashStringHelper *text) {
+    return print(reinterpret_cast<const char *>(text));
+  }
+  size_t print(const char text[]) { return write(text); }
+  size_t print(char character) { return write(character); }
+  size_t print(unsigned char value, int base = DEC) { return print((unsigned long)value, base); }
+  size_t print(int value, int base = DEC) { return print((long)value, base); }
+  size_t print(unsigned int value, int base = DEC) { return print((unsigned long)value, base); }
+
+  size_t print(long value, int base = DEC) {
+    if (base == 0) {
+      return write((uint8_t)value);
+    }
+    if ((base == 10) && (value < 0)) {
+      return print('-') + print_number(-(unsigned long)value, 10);
+    }
+    return print_number(value, base);
+  }
+
+  size_t print(unsigned long value, int base = DEC) {
+    return (base == 0) ? write((uint8_t)value) : print_number(value, base);
+  }
+
+  size_t print(double value, int digits = 2) { return print_float(value, digits); }
+
+  size_t println() { return write("\r\n"); }
+
+  template <typename T>
+  size_t println(T value) { return print(value) + println(); }
+
+private:
+  size_t print_number(unsigned long value, uint8_t base) {
+    char buffer[8 * sizeof(long) + 1];
+    char *p_text = &buffer[sizeof(buffer) - 1];
+    *p_text = '\0';
+    if (base < 2) {
+      base = 10;
+    }
+    do {
+      const char digit = value % base;
+      value /= base;
+      *--p_text = (digit < 10) ? digit + '0' : digit + 'A' - 10;
+    } while (value != 0);
+    return write(p_text);
+  }
+
+  size_t print_float(double value, uint8_t digits) {
+    if (isnan(value)) return print("nan");
+    if (isinf(value)) return print("inf");
+    if ((value > 4294967040.0) || (value < -4294967040.0)) return print("ovf");
+
+    size_t n = 0;
+    if (value < 0.0) {
+      n += print('-');
+      value = -value;
+    }
+    double rounding = 0.5;
+    for (uint8_t i = 0; i < digits; i++) {
+      rounding /= 10.0;
+    }
+    value += rounding;
+    const unsigned long integer = (unsigned long)value;
+    double remainder = value - (double)integer;
+    n += print(integer);
+    if (digits > 0) {
+      n += print('.');
+    }
+    while (digits-- > 0) {
+      remainder *= 10.0;
+      const unsigned int digit = (unsigned int)remainder;
+      n += print(digit);
+      remainder -= digit;
+    }
+    return n;
+  }
+};
@@ -0,0 +1,15 @@
+/**
+@file
+Host stand-in for the Arduino core's `WString.h`, only the flash string
+helper is provided.
+*/
+
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+#include "avr/pgmspace.h"
+
+class __FlashStringHelper;
+
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(PSTR(string_literal)))
@@ -0,0 +1,8 @@
+/**
+@file
+Definition of the host stand-in for the `Wire` object.
+*/
+
+#include "Wire.h"
+
+TwoWire Wire;
@@ -0,0 +1,85 @@
+/**
+@file
+Host stand-in for Arduino's `Wire` library.
+
+Records every transmission as the list of the bytes sent in it. Like the
+Arduino's library it buffers up to `BUFFER_LENGTH` bytes, the bytes written
+after that are counted as overflows and dropped.
+*/
+
+#pragma once
+
+#include <vector>
+#include "Arduino.h"
+
+#define BUFFER_LENGTH 32
+
+class TwoWire {
+public:
+  /// A recorded transmission.
+  struct Transmission {
+    uint8_t address; ///< The I2C address
+    std::vector<uint8_t> bytes; ///< The sent bytes
+  };
+
+  void begin() {}
+
+  void setClock(uint32_t clock) { (void)clock; }
+
+  void beginTransmission(uint8_t address) {
+    if (_open) {
+      nestedTransmissions++;
+    }
+    _open = true;
+    transmissions.push_back(Transmission{ address, std::vector<uint8_t>() });
+  }
+
+  size_t write(uint8_t value) {
+    if (!_open || (transmissions.back().bytes.size() == BUFFER_LENGTH)) {
+      overflows++;
+      return 0;
+    }
+    transmissions.back().bytes.push_back(value);
+    return 1;
+  }
+
+  uint8_t endTransmission(bool sendStop = true) {
+    (void)sendStop;
+    _open = false;
+    return 0;
+  }
+
+  /// Forgets the recorded transmissions and the errors.
+  void reset() {
+    transmissions.clear();
+    overflows = 0;
+    nestedTransmissions = 0;
+  }
+
+  /// Returns the count of the sent bytes, without the addresses.
+  size_t get_byteCount() const {
+    size_t count = 0;
+    for (const Transmission &transmission : transmissions) {
+      count += transmission.bytes.size();
+    }
+    return count;
+  }
+
+  /// Returns the bus time in bit periods.
+  /**
+  A start and a stop condition, the address and every byte with its
+  acknowledge bit.
+  */
+  size_t get_bitCount() const {
+    return 2 * transmissions.size() + 9 * (transmissions.size() + get_byteCount());
+  }
+
+  std::vector<Transmission> transmissions; ///< The recorded transmissions
+  unsigned overflows = 0; ///< Bytes which didn't fit in the buffer
+  unsigned nestedTransmissions = 0; ///< Transmissions begun before the previous ended
+
+private:
+  bool _open = false;
+};
+
+extern TwoWire Wire;
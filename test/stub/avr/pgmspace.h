@@ -0,0 +1,21 @@
+/**
+@file
+Host stand-in for `<avr/pgmspace.h>`, flash memory is ordinary memory.
+*/
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+
+#define pgm_read_byte(address) (*(const uint8_t *)(address))
+#define pgm_read_byte_near(address) pgm_read_byte(address)
+#define pgm_read_word(address) (*(const uint16_t *)(address))
+#define pgm_read_ptr(address) (*(void * const *)(address))
+
+#define strlen_P strlen
+#define memcpy_P memcpy
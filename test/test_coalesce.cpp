@@ -0,0 +1,161 @@
+/**
+@file
+Tests of merging nearby runs of changed characters.
+
+Two runs separated by unchanged characters are sent as one when the gap is
+at most `(cursorCost - 1) / characterCost` characters. The tests check the
+exact commands sent to a recording driver on both sides of that boundary.
+*/
+
+#include <string>
+#include <type_traits>
+
+#include <LiquidMenu.h>
+
+#include "check.h"
+
+static_assert(!std::is_destructible<LiquidDisplayDriver>::value,
+              "A driver isn't destroyed through the interface");
+
+/// Records the commands as text, with the costs set by the test.
+/**
+`write_at()` is recorded as "@column,row:characters " and a write at the
+cursor as "+characters ".
+*/
+class RecordingDriver : public LiquidDisplayDriver {
+public:
+  /// Sets the costs the menu is told.
+  void set_costs(uint8_t cursorCost, uint8_t characterCost) {
+    _cursorCost = cursorCost;
+    _characterCost = characterCost;
+  }
+
+  virtual void clear() {
+    log += "clear ";
+  }
+
+  virtual void setCursor(uint8_t column, uint8_t row) {
+    log += "@" + std::to_string(column) + "," + std::to_string(row) + ": ";
+  }
+
+  virtual void write(uint8_t character) {
+    log += "+" + std::string(1, (char)character) + " ";
+  }
+
+  virtual void write(const uint8_t *buffer, uint8_t size) {
+    log += "+" + std::string((const char*)buffer, size) + " ";
+  }
+
+  virtual void write_at(uint8_t column, uint8_t row,
+                        const uint8_t *buffer, uint8_t size) {
+    log += "@" + std::to_string(column) + "," + std::to_string(row) + ":"
+      + std::string((const char*)buffer, size) + " ";
+  }
+
+  virtual uint8_t get_cursorCost() const {
+    return _cursorCost;
+  }
+
+  virtual uint8_t get_characterCost() const {
+    return _characterCost;
+  }
+
+  virtual void createChar(uint8_t index, uint8_t glyph[8]) {
+    (void)index;
+    (void)glyph;
+    log += "glyph ";
+  }
+
+  std::string log; ///< The recorded commands
+
+private:
+  uint8_t _cursorCost = 1;
+  uint8_t _characterCost = 1;
+};
+
+const char TEXT[] = "0123456789ABCDEF";
+
+RecordingDriver driver;
+char text[17];
+LiquidLine text_line(0, 0, text);
+LiquidScreen text_screen(text_line);
+LiquidMenu menu(driver, text_screen);
+
+/// Changes the first character and the one after a gap of unchanged ones.
+/**
+@param cursorCost - the cost of positioning the cursor
+@param characterCost - the cost of writing a character
+@param gap - the count of the unchanged characters between the changes
+@returns the commands sent for the change
+*/
+static std::string change_around(uint8_t cursorCost, uint8_t characterCost,
+                                 uint8_t gap) {
+  driver.set_costs(cursorCost, characterCost);
+  memcpy(text, TEXT, sizeof(TEXT));
+  menu.update();
+  menu.reset_stats();
+  driver.log.clear();
+
+  text[0] = 'x';
+  text[gap + 1] = 'y';
+  menu.softUpdate();
+  return driver.log;
+}
+
+/// The longest gap is rewritten, a longer one positions the cursor.
+static void test_boundary() {
+  // (4 - 1) / 1 = 3
+  CHECK_EQUAL("@0,0:x123y ", change_around(4, 1, 3));
+  CHECK_EQUAL(3, menu.get_stats().rewrites);
+  CHECK_EQUAL(1, menu.get_stats().cursorMoves);
+  CHECK_EQUAL("@0,0:x @5,0:y ", change_around(4, 1, 4));
+  CHECK_EQUAL(0, menu.get_stats().rewrites);
+  CHECK_EQUAL(2, menu.get_stats().cursorMoves);
+
+  // (5 - 1) / 2 = 2, rounded down: 3 * 2 > 5 - 1.
+  CHECK_EQUAL("@0,0:x12y ", change_around(5, 2, 2));
+  CHECK_EQUAL("@0,0:x @4,0:y ", change_around(5, 2, 3));
+
+  // The PCF8574 backend's costs, (7 - 1) / 4 = 1.
+  CHECK_EQUAL("@0,0:x1y ", change_around(7, 4, 1));
+  CHECK_EQUAL("@0,0:x @3,0:y ", change_around(7, 4, 2));
+}
+
+/// Equal costs never rewrite, not even a single character.
+static void test_noMerging() {
+  CHECK_EQUAL("@0,0:x @2,0:y ", change_around(1, 1, 1));
+  CHECK_EQUAL(0, menu.get_stats().rewrites);
+  // A cost of 0 turns the merging off too.
+  CHECK_EQUAL("@0,0:x @2,0:y ", change_around(8, 0, 1));
+  CHECK_EQUAL("@0,0:x @2,0:y ", change_around(0, 1, 1));
+}
+
+/// Unchanged characters after the last run aren't rewritten.
+static void test_trailingGap() {
+  driver.set_costs(8, 1);
+  memcpy(text, TEXT, sizeof(TEXT));
+  menu.update();
+  menu.reset_stats();
+  driver.log.clear();
+
+  text[13] = 'z';
+  menu.softUpdate();
+  CHECK_EQUAL("@13,0:z ", driver.log);
+  CHECK_EQUAL(0, menu.get_stats().rewrites);
+
+  // The next run starts where the cursor is, it isn't positioned.
+  driver.log.clear();
+  text[14] = 'w';
+  menu.softUpdate();
+  CHECK_EQUAL("+w ", driver.log);
+}
+
+int main() {
+  menu.set_displaySize(16, 2);
+  menu.set_clearOnUpdate(false);
+  menu.init();
+  test_boundary();
+  test_noMerging();
+  test_trailingGap();
+  return check_result("test_coalesce");
+}
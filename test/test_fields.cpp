@@ -0,0 +1,64 @@
+/**
+@file
+Tests of the fixed width fields of the variables.
+
+A LiquidLine gets its fields with `set_fieldWidth()` and a typed line
+with `as_field()`. The tests check that both print the same fields,
+aligned to the left, to the right and padded with zeros, and that a
+value overwrites the previous one in place.
+*/
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+#include "check.h"
+
+LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
+
+int16_t level = 42;
+uint8_t count = 7;
+char name[8] = "abc";
+
+LiquidLine level_line(0, 0, level, "|", count, "|", name);
+auto typed_line = make_liquidLine(0, 1, as_field(level, 5, Align::ZERO), "|",
+                                  as_field(count, 3, Align::RIGHT), "|",
+                                  as_field(name, 4));
+LiquidScreen fields_screen(level_line, typed_line);
+
+LiquidMenu menu(lcd, fields_screen);
+
+/// Both lines print their variables in the same fields.
+static void test_sameFields() {
+  CHECK(level_line.set_fieldWidth(1, 5, Align::ZERO));
+  CHECK(level_line.set_fieldWidth(3, 3, Align::RIGHT));
+  CHECK(level_line.set_fieldWidth(5, 4));
+  menu.update();
+  CHECK_EQUAL("00042|  7|abc   ", lcd.controller.get_row(0));
+  CHECK_EQUAL(lcd.controller.get_row(0), lcd.controller.get_row(1));
+
+  // The values are overwritten in place, the separators don't move.
+  level = -3;
+  count = 123;
+  strcpy(name, "abcdefg");
+  menu.softUpdate();
+  CHECK_EQUAL("-0003|123|abcd  ", lcd.controller.get_row(0));
+  CHECK_EQUAL(lcd.controller.get_row(0), lcd.controller.get_row(1));
+}
+
+/// A width of 0 prints the variable as it is.
+static void test_noField() {
+  auto line = make_liquidLine(0, 0, as_field(count, 0), "|");
+  LiquidScreen screen(line);
+  LiquidMenu plain_menu(lcd, screen);
+  count = 5;
+  plain_menu.update();
+  CHECK_EQUAL("5|              ", lcd.controller.get_row(0));
+}
+
+int main() {
+  lcd.begin(16, 2);
+  menu.init();
+  test_sameFields();
+  test_noField();
+  return check_result("test_fields");
+}
@@ -0,0 +1,205 @@
+/**
+@file
+Tests of the getter caches.
+
+Every getter added to a line takes one of the `MAX_GETTER_CACHES` caches.
+The tests check that `refresh_getters()` redraws a cached getter only when
+its value changed, that it calls every getter once, that the getters
+refused a cache are always redrawn and that they are counted. The lines
+of a flash screen are compared the same way.
+*/
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+#include "check.h"
+
+int level = 10;
+uint8_t levelCalls = 0;
+
+int get_level() {
+  levelCalls++;
+  return level;
+}
+
+const char* get_state() {
+  return (level < 50) ? "low" : "high";
+}
+
+char name[8] = "pump";
+
+char* get_name() {
+  return name;
+}
+
+int get_zero() {
+  return 0;
+}
+
+uint8_t oneCalls = 0;
+
+int get_one() {
+  oneCalls++;
+  return 1;
+}
+
+int get_two() {
+  return 2;
+}
+
+template <int N>
+int get_number() {
+  return N;
+}
+
+uint8_t flashCalls = 0;
+
+int get_flash() {
+  flashCalls++;
+  return level;
+}
+
+const char flash_text[] PROGMEM = "Flash: ";
+constexpr LiquidVariableDef text_variables[] PROGMEM = {
+  as_progmem(flash_text)
+};
+constexpr LiquidVariableDef getter_variables[] PROGMEM = {
+  as_progmem(flash_text), get_flash
+};
+constexpr LiquidLineDef flash_lines[] PROGMEM = {
+  make_liquidLineDef(0, 0, text_variables),
+  make_liquidLineDef(0, 1, getter_variables),
+};
+
+LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
+
+/// An unchanged value isn't redrawn, a changed one is.
+static void test_cached() {
+  LiquidLine level_line(0, 0, "Level: ", get_level);
+  LiquidLine state_line(0, 1, get_state);
+  LiquidScreen screen(level_line, state_line);
+  LiquidMenu menu(lcd, screen);
+  menu.set_displaySize(16, 2);
+  menu.init();
+  menu.update();
+  CHECK_EQUAL("Level: 10       ", lcd.controller.get_row(0));
+  CHECK_EQUAL("low             ", lcd.controller.get_row(1));
+
+  CHECK(!menu.refresh_getters());
+
+  // The same text from the same pointer is unchanged. The line is printed
+  // with the value that was compared.
+  level = 20;
+  levelCalls = 0;
+  CHECK(menu.refresh_getters());
+  CHECK_EQUAL(1, levelCalls);
+  CHECK_EQUAL("Level: 20       ", lcd.controller.get_row(0));
+  CHECK(!menu.refresh_getters());
+
+  // The `const char*` getter returns another pointer.
+  level = 60;
+  CHECK(menu.refresh_getters());
+  CHECK_EQUAL("high            ", lcd.controller.get_row(1));
+}
+
+/// A cached getter isn't called again before its interval elapsed.
+static void test_interval() {
+  LiquidLine level_line(0, 0, "Level: ", get_level);
+  CHECK(level_line.set_getterInterval(100));
+  LiquidScreen screen(level_line);
+  LiquidMenu menu(lcd, screen);
+  menu.set_displaySize(16, 2);
+  menu.init();
+  host_advanceUs(100000);
+  menu.update();
+
+  level = 30;
+  levelCalls = 0;
+  CHECK(!menu.refresh_getters());
+  CHECK_EQUAL(0, levelCalls);
+  host_advanceUs(100000);
+  CHECK(menu.refresh_getters());
+  CHECK_EQUAL(1, levelCalls);
+  CHECK_EQUAL("Level: 30       ", lcd.controller.get_row(0));
+  level_line.set_getterInterval(0);
+}
+
+/// A `char*` getter is always new.
+static void test_charPointer() {
+  LiquidLine name_line(0, 0, "Name: ", get_name);
+  LiquidLine zero_line(0, 1, get_zero);
+  LiquidScreen screen(name_line, zero_line);
+  LiquidMenu menu(lcd, screen);
+  menu.set_displaySize(16, 2);
+  menu.init();
+  menu.update();
+  CHECK_EQUAL("Name: pump      ", lcd.controller.get_row(0));
+
+  // Only the changed characters are sent.
+  lcd.controller.reset_counters();
+  CHECK(menu.refresh_getters());
+  CHECK_EQUAL(0, lcd.controller.get_counters().bytes());
+
+  strcpy(name, "fan");
+  CHECK(menu.refresh_getters());
+  CHECK_EQUAL("Name: fan       ", lcd.controller.get_row(0));
+}
+
+/// The getters of a flash line are compared and printed once.
+static void test_flashScreen() {
+  LiquidFlashScreen screen(flash_lines);
+  LiquidMenu menu(lcd, screen);
+  menu.set_displaySize(16, 2);
+  menu.init();
+  level = 70;
+  menu.update();
+  CHECK_EQUAL("Flash: 70       ", lcd.controller.get_row(1));
+
+  flashCalls = 0;
+  CHECK(!menu.refresh_getters());
+  CHECK_EQUAL(1, flashCalls);
+
+  // Only the second line is redrawn.
+  level = 80;
+  flashCalls = 0;
+  lcd.controller.reset_counters();
+  CHECK(menu.refresh_getters());
+  CHECK_EQUAL(1, flashCalls);
+  CHECK_EQUAL("Flash: 80       ", lcd.controller.get_row(1));
+  CHECK_EQUAL(1, lcd.controller.get_counters().characters);
+}
+
+/// The getters refused a cache are counted and still printed once.
+static void test_missing() {
+  CHECK_EQUAL(0, LiquidLine::get_missingGetterCaches());
+  // The 5 getters of the previous tests keep their caches, these take the
+  // other 3.
+  LiquidLine taken_line(0, 1, get_number<1>, get_number<2>, get_number<3>);
+  CHECK(taken_line.set_getterInterval(0));
+  CHECK_EQUAL(0, LiquidLine::get_missingGetterCaches());
+
+  LiquidLine refused_line(0, 0, get_one, " ", get_two);
+  CHECK_EQUAL(2, LiquidLine::get_missingGetterCaches());
+  CHECK(!refused_line.set_getterInterval(0));
+  CHECK_EQUAL(2, LiquidLine::get_missingGetterCaches());
+
+  LiquidScreen screen(refused_line);
+  LiquidMenu menu(lcd, screen);
+  menu.set_displaySize(16, 2);
+  menu.init();
+  menu.update();
+  CHECK_EQUAL("1 2             ", lcd.controller.get_row(0));
+  oneCalls = 0;
+  CHECK(menu.refresh_getters());
+  CHECK_EQUAL(1, oneCalls);
+}
+
+int main() {
+  lcd.begin(16, 2);
+  test_cached();
+  test_interval();
+  test_charPointer();
+  test_flashScreen();
+  test_missing();
+  return check_result("test_getters");
+}
@@ -0,0 +1,84 @@
+/**
+@file
+Tests of the glyph slots reserved for the user.
+
+The menu uploads the glyphs of its lines to the least recently used slots
+of the display. A slot reserved with `reserve_glyphSlot()` keeps the glyph
+the user created there, even before a line printing it by index is shown.
+*/
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+#include "check.h"
+
+LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
+
+/// The user's glyph, created with `createChar()`.
+uint8_t user_glyph[8] = { 0x1F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F };
+
+/// The glyphs of the menu's lines, a different one on every row.
+uint8_t line_glyphs[8][8];
+
+/// Creates the user's glyph and shows 8 of the menu's glyphs.
+/**
+@param reserve - reserves the user's slot
+@returns true if the user's glyph is still in its slot
+*/
+static bool show_glyphs(bool reserve) {
+  LiquidLine line1(0, 0, line_glyphs[0], line_glyphs[1], line_glyphs[2], line_glyphs[3]);
+  LiquidLine line2(0, 0, line_glyphs[4], line_glyphs[5], line_glyphs[6], line_glyphs[7]);
+  LiquidScreen screen1(line1);
+  LiquidScreen screen2(line2);
+  LiquidMenu menu(lcd, screen1, screen2);
+  menu.set_displaySize(16, 2);
+  menu.init();
+  lcd.createChar(0, user_glyph);
+  if (reserve) {
+    CHECK(menu.reserve_glyphSlot(0));
+  }
+  menu.update();
+  menu.next_screen();
+  // After `init()` the reservation still holds.
+  menu.init();
+  menu.previous_screen();
+  for (uint8_t l = 0; l < 8; l++) {
+    if (lcd.controller.get_glyphLine(0, l) != user_glyph[l]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Without a reservation the menu replaces the user's glyph.
+static void test_unreserved() {
+  CHECK(!show_glyphs(false));
+}
+
+/// A reserved slot is never used by the menu.
+static void test_reserved() {
+  CHECK(show_glyphs(true));
+  CHECK_EQUAL("\x07\x06\x05\x04            ", lcd.controller.get_row(0));
+}
+
+/// Only the 8 slots of the display can be reserved.
+static void test_invalidSlot() {
+  LiquidLine line(0, 0, "Glyphs");
+  LiquidScreen screen(line);
+  LiquidMenu menu(lcd, screen);
+  CHECK(menu.reserve_glyphSlot(7));
+  CHECK(!menu.reserve_glyphSlot(8));
+}
+
+int main() {
+  for (uint8_t g = 0; g < 8; g++) {
+    for (uint8_t l = 0; l < 8; l++) {
+      line_glyphs[g][l] = (g << 2) | l;
+    }
+  }
+  lcd.begin(16, 2);
+  test_unreserved();
+  test_reserved();
+  test_invalidSlot();
+  return check_result("test_glyphs");
+}
@@ -0,0 +1,119 @@
+/**
+@file
+Tests of the line slots shared by all lines.
+
+The variables and the functions of the lines are kept in `MAX_LINE_SLOTS`
+slots. The tests check that a line releases its slots when it's destroyed
+or moved from, that a line can't be copied and that the slots which were
+missing are counted.
+*/
+
+#include <type_traits>
+#include <vector>
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+#include "check.h"
+
+static_assert(!std::is_copy_constructible<LiquidLine>::value,
+              "A copy of a line would share its slots");
+static_assert(!std::is_copy_assignable<LiquidLine>::value,
+              "A copy of a line would share its slots");
+static_assert(std::is_move_constructible<LiquidLine>::value,
+              "A line can be returned from a function");
+
+static void blank_function() {}
+
+uint8_t level = 42;
+
+/// Returns a line with a variable and a function.
+static LiquidLine make_levelLine() {
+  LiquidLine line(0, 1, "Level: ", level);
+  line.attach_function(1, blank_function);
+  return line;
+}
+
+/// A destroyed line gives its slots back.
+static void test_release() {
+  const uint8_t freeSlots = LiquidLineBase::get_freeSlots();
+  CHECK_EQUAL(MAX_LINE_SLOTS, freeSlots);
+  {
+    LiquidLine line(0, 0, "Level: ", level, "%");
+    CHECK_EQUAL(freeSlots - 3, LiquidLineBase::get_freeSlots());
+    line.attach_function(1, blank_function);
+    line.attach_function(2, blank_function);
+    CHECK_EQUAL(freeSlots - 5, LiquidLineBase::get_freeSlots());
+    // A function attached again under the same number takes no slot.
+    line.attach_function(2, blank_function);
+    CHECK_EQUAL(freeSlots - 5, LiquidLineBase::get_freeSlots());
+  }
+  CHECK_EQUAL(freeSlots, LiquidLineBase::get_freeSlots());
+
+  // The released slots are taken again by the next lines.
+  {
+    LiquidLine line1(0, 0, "A", level);
+    LiquidLine line2(0, 1, "B");
+    CHECK_EQUAL(freeSlots - 3, LiquidLineBase::get_freeSlots());
+  }
+  CHECK_EQUAL(freeSlots, LiquidLineBase::get_freeSlots());
+}
+
+/// A moved line keeps its variables and functions, only once.
+static void test_move() {
+  const uint8_t freeSlots = LiquidLineBase::get_freeSlots();
+  {
+    LiquidLine level_line = make_levelLine();
+    CHECK_EQUAL(freeSlots - 3, LiquidLineBase::get_freeSlots());
+
+    LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
+    LiquidScreen screen(level_line);
+    LiquidMenu menu(lcd, screen);
+    lcd.begin(16, 2);
+    menu.update();
+    CHECK_EQUAL("Level: 42       ", lcd.controller.get_row(1));
+    CHECK(menu.set_focusedLine(0));
+    CHECK(menu.call_function(1));
+  }
+  CHECK_EQUAL(freeSlots, LiquidLineBase::get_freeSlots());
+
+  // The typed lines keep their variables themselves, only the function
+  // takes a slot.
+  {
+    auto typed_line = make_liquidLine(0, 0, "Level: ", level);
+    typed_line.attach_function(1, blank_function);
+    CHECK_EQUAL(freeSlots - 1, LiquidLineBase::get_freeSlots());
+  }
+  CHECK_EQUAL(freeSlots, LiquidLineBase::get_freeSlots());
+}
+
+/// The variables and functions added when no slot is left are counted.
+static void test_missing() {
+  const uint8_t freeSlots = LiquidLineBase::get_freeSlots();
+  CHECK_EQUAL(0, LiquidLineBase::get_missingSlots());
+  {
+    std::vector<LiquidLine> lines;
+    lines.reserve(MAX_LINE_SLOTS);
+    for (uint8_t l = 0; l < MAX_LINE_SLOTS; l++) {
+      lines.emplace_back(0, 0, level);
+    }
+    CHECK_EQUAL(0, LiquidLineBase::get_freeSlots());
+    CHECK_EQUAL(0, LiquidLineBase::get_missingSlots());
+
+    LiquidLine full_line(0, 0, "Level: ", level);
+    CHECK(!full_line.attach_function(1, blank_function));
+    CHECK_EQUAL(3, LiquidLineBase::get_missingSlots());
+
+    // A released slot can be taken again.
+    lines.pop_back();
+    CHECK(full_line.attach_function(1, blank_function));
+  }
+  CHECK_EQUAL(freeSlots, LiquidLineBase::get_freeSlots());
+}
+
+int main() {
+  test_release();
+  test_move();
+  test_missing();
+  return check_result("test_lines");
+}
@@ -0,0 +1,106 @@
+/**
+@file
+Tests of the list screens.
+
+The items of a LiquidListScreen can start below the first row with a
+header line above them. The tests check where the items and the header
+are printed while the list scrolls, that the header isn't focused with
+the items, that the focus indicator is cleared when the focus is
+"ghosted" after the last item and that the count of the rows can be set
+through the base class.
+*/
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+#include "check.h"
+
+LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
+
+uint16_t selected = NO_ITEM;
+
+static void print_channel(uint16_t index, Print &output) {
+  output.print("Channel ");
+  output.print(index + 1);
+}
+
+static void select_channel() {
+  selected = 1;
+}
+
+LiquidLine channels_line(0, 0, "Channels");
+LiquidListScreen channel_screen(print_channel, 3, 3, 1, 1);
+
+LiquidMenu menu(lcd, channel_screen);
+
+/// The items start at their first row and scroll under the header.
+static void test_header() {
+  channel_screen.set_header(channels_line);
+  menu.update();
+  CHECK_EQUAL("Channels            ", lcd.controller.get_row(0));
+  CHECK_EQUAL(" Channel 1          ", lcd.controller.get_row(1));
+  CHECK_EQUAL(" Channel 3          ", lcd.controller.get_row(3));
+
+  channel_screen.set_itemCount(10);
+  CHECK(channel_screen.set_focusedItem(9));
+  menu.update();
+  CHECK_EQUAL(7, channel_screen.get_firstItem());
+  CHECK_EQUAL("Channels            ", lcd.controller.get_row(0));
+  CHECK_EQUAL(" Channel 8          ", lcd.controller.get_row(1));
+  // The focus indicator is left of the focused item.
+  CHECK_EQUAL("Channel 10         ", lcd.controller.get_row(3).substr(1));
+  // The header is the screen's line 0, the items' lines follow it.
+  CHECK_EQUAL(3, menu.get_focusedLine());
+  CHECK(!menu.set_focusedLine(0));
+  CHECK(menu.set_focusedLine(1));
+  CHECK_EQUAL(7, channel_screen.get_focusedItem());
+}
+
+/// The focus indicator is cleared when the focus is hidden.
+static void test_ghosting() {
+  channel_screen.set_itemCount(3);
+  CHECK(channel_screen.set_focusedItem(2));
+  menu.update();
+  CHECK(lcd.controller.get_character(0, 3) != ' ');
+
+  menu.switch_focus(true);
+  CHECK_EQUAL(NO_ITEM, channel_screen.get_focusedItem());
+  CHECK_EQUAL(4, menu.get_focusedLine());
+  for (uint8_t r = 1; r < 4; r++) {
+    CHECK_EQUAL(' ', lcd.controller.get_character(0, r));
+  }
+  CHECK(!menu.call_function(1));
+  CHECK_EQUAL(NO_ITEM, selected);
+
+  menu.switch_focus(true);
+  CHECK_EQUAL(0, channel_screen.get_focusedItem());
+  CHECK(lcd.controller.get_character(0, 1) != ' ');
+  CHECK(menu.call_function(1));
+  CHECK_EQUAL(1, selected);
+}
+
+/// The rows set through the base class are the rows of the items.
+static void test_rows() {
+  channel_screen.set_itemCount(10);
+  CHECK(channel_screen.set_focusedItem(0));
+  LiquidScreenBase &screen = channel_screen;
+  screen.set_displayLineCount(2);
+  menu.update();
+  CHECK_EQUAL("Channels            ", lcd.controller.get_row(0));
+  CHECK_EQUAL("Channel 2          ", lcd.controller.get_row(2).substr(1));
+  CHECK_EQUAL("                    ", lcd.controller.get_row(3));
+  CHECK(channel_screen.set_focusedItem(2));
+  CHECK_EQUAL(1, channel_screen.get_firstItem());
+}
+
+int main() {
+  lcd.begin(20, 4);
+  menu.set_displaySize(20, 4);
+  channel_screen.attach_function(1, select_channel);
+  channel_screen.set_focusPosition(Position::LEFT);
+  menu.init();
+  test_header();
+  test_ghosting();
+  test_rows();
+  return check_result("test_list");
+}
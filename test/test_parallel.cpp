@@ -0,0 +1,202 @@
+/**
+@file
+Tests of the parallel backend against a simulated controller.
+
+The controller (`HD44780Pins`) is driven through the pins and counts the
+bytes sent while it was busy, so the tests check that the backend waits
+long enough, and not much longer, with and without the busy flag.
+*/
+
+#include <LiquidMenu.h>
+#include <LiquidParallel.h>
+
+#include "check.h"
+#include "HD44780Pins.h"
+
+// The pins, D4..D7 are 2..5.
+const uint8_t RS = 12;
+const uint8_t RW = 10;
+const uint8_t ENABLE = 11;
+const uint8_t D4 = 2;
+
+/// Returns the average time of writing a character in microseconds.
+static uint32_t character_time(LiquidParallel &lcd) {
+  lcd.setCursor(0, 1);
+  const uint32_t start = host_nowUs();
+  for (uint8_t i = 0; i < 16; i++) {
+    lcd.write('a' + i);
+  }
+  return (host_nowUs() - start) / 16;
+}
+
+/// Without R/W the datasheet's longest times are waited.
+static void test_noRwPin() {
+  // The slowest oscillator (190 kHz) of the datasheet.
+  HD44780Pins display(RS, HD44780Pins::NO_PIN, ENABLE, D4);
+  display.executionPercent = 71;
+  host_setPins(&display);
+  LiquidParallel lcd(RS, ENABLE, D4, D4 + 1, D4 + 2, D4 + 3);
+  lcd.begin(16, 2);
+
+  lcd.print("No R/W pin");
+  lcd.clear();
+  lcd.print("Cleared");
+  const uint32_t characterUs = character_time(lcd);
+  CHECK_EQUAL(0, display.reads);
+  CHECK_EQUAL(0, display.busyBytes);
+  CHECK_EQUAL(0, display.floatingNibbles);
+  CHECK_EQUAL("Cleared         ", display.controller.get_row(0));
+  CHECK_EQUAL("abcdefghijklmnop", display.controller.get_row(1));
+  // 53 microseconds and the pin operations of a character.
+  CHECK(characterUs >= 53);
+  CHECK(characterUs < 53 + 40);
+  host_setPins(nullptr);
+}
+
+/// With R/W the execution time is measured and the waits end sooner on a
+/// fast display.
+static void test_busyFlag() {
+  // A display twice as fast as the datasheet's, measured without and with
+  // its busy flag.
+  uint32_t characterUs[2];
+  uint32_t clearUs[2];
+  for (uint8_t withRw = 0; withRw < 2; withRw++) {
+    HD44780Pins display(RS, withRw ? RW : HD44780Pins::NO_PIN, ENABLE, D4);
+    display.executionPercent = 200;
+    host_setPins(&display);
+    LiquidParallel lcd = withRw ? LiquidParallel(RS, RW, ENABLE, D4, D4 + 1, D4 + 2, D4 + 3)
+                                : LiquidParallel(RS, ENABLE, D4, D4 + 1, D4 + 2, D4 + 3);
+    lcd.begin(16, 2);
+    if (withRw) {
+      // The busy flag is read and the direction of the data pins is
+      // switched back and forth without both sides driving them. The
+      // probes leave the address counter where clear put it.
+      CHECK_EQUAL(7, display.reads);
+      CHECK_EQUAL(0, display.conflicts);
+      CHECK_EQUAL(0x00, display.controller.get_address());
+    }
+    CHECK_EQUAL(0, display.floatingNibbles);
+    CHECK_EQUAL(0, display.busyBytes);
+
+    display.reset_counts();
+    characterUs[withRw] = character_time(lcd);
+    CHECK_EQUAL(0, display.busyBytes);
+    CHECK_EQUAL("abcdefghijklmnop", display.controller.get_row(1));
+    if (withRw) {
+      // The byte waits less than the datasheet's 53 microseconds after
+      // the display got ready.
+      CHECK(display.maxIdleUs < 53);
+    }
+
+    // The wait after clear is scaled from the measured time too.
+    lcd.clear();
+    const uint32_t start = host_nowUs();
+    lcd.write('X');
+    clearUs[withRw] = host_nowUs() - start;
+    CHECK_EQUAL(0, display.busyBytes);
+    CHECK_EQUAL('X', display.controller.get_character(0, 0));
+    host_setPins(nullptr);
+  }
+  CHECK(characterUs[1] + 15 < characterUs[0]);
+  CHECK(clearUs[1] + 2160 / 4 < clearUs[0]);
+}
+
+/// A busy flag that can't be read back falls back to the datasheet's times.
+static void test_stuckBusyFlag() {
+  const HD44780Pins::BusyFlag flags[] = { HD44780Pins::BusyFlag::STUCK_BUSY,
+                                          HD44780Pins::BusyFlag::STUCK_READY };
+  for (HD44780Pins::BusyFlag flag : flags) {
+    HD44780Pins display(RS, RW, ENABLE, D4);
+    display.executionPercent = 71;
+    display.busyFlag = flag;
+    host_setPins(&display);
+    LiquidParallel lcd(RS, RW, ENABLE, D4, D4 + 1, D4 + 2, D4 + 3);
+    // The calibration ends even if the flag never changes.
+    lcd.begin(16, 2);
+    CHECK_EQUAL(7, display.reads);
+
+    lcd.clear();
+    const uint32_t characterUs = character_time(lcd);
+    CHECK_EQUAL(0, display.busyBytes);
+    CHECK_EQUAL(0, display.conflicts);
+    CHECK(characterUs >= 53);
+    CHECK_EQUAL("abcdefghijklmnop", display.controller.get_row(1));
+    host_setPins(nullptr);
+  }
+}
+
+/// The address counter follows the writes and jumps between the lines.
+static void test_addressCounter() {
+  HD44780Pins display(RS, RW, ENABLE, D4);
+  display.controller.set_size(20, 4);
+  host_setPins(&display);
+  LiquidParallel lcd(RS, RW, ENABLE, D4, D4 + 1, D4 + 2, D4 + 3);
+  lcd.begin(20, 4);
+
+  lcd.setCursor(18, 0);
+  lcd.print("ABCD");
+  // The first line continues on the third row of a 20x4 display.
+  CHECK_EQUAL(0x16, display.controller.get_address());
+  CHECK_EQUAL("                  AB", display.controller.get_row(0));
+  CHECK_EQUAL("CD                  ", display.controller.get_row(2));
+
+  lcd.setCursor(18, 3);
+  lcd.print("EFGH");
+  // 0x40 + 20 + 20 = 0x68 is after the second line, it jumps to 0x00.
+  CHECK_EQUAL(0x02, display.controller.get_address());
+  CHECK_EQUAL("GH                AB", display.controller.get_row(0));
+  CHECK_EQUAL("                  EF", display.controller.get_row(3));
+
+  // A glyph moves the counter into CGRAM, the next position moves it back.
+  uint8_t glyph[8] = { 0x1F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F };
+  lcd.createChar(2, glyph);
+  CHECK_EQUAL(0x18, display.controller.get_address());
+  CHECK_EQUAL(0x11, display.controller.get_glyphLine(2, 3));
+  lcd.setCursor(0, 1);
+  lcd.write(2);
+  CHECK_EQUAL(0x41, display.controller.get_address());
+  CHECK_EQUAL(2, display.controller.get_character(0, 1));
+
+  CHECK_EQUAL(0, display.busyBytes);
+  CHECK_EQUAL(0, display.conflicts);
+  CHECK_EQUAL(0, display.floatingNibbles);
+  host_setPins(nullptr);
+}
+
+/// A menu drawn through the backend is shown on the display.
+static void test_menu() {
+  HD44780Pins display(RS, RW, ENABLE, D4);
+  host_setPins(&display);
+  LiquidParallel lcd(RS, RW, ENABLE, D4, D4 + 1, D4 + 2, D4 + 3);
+  auto driver = make_liquidDriver(lcd);
+
+  uint8_t level = 100;
+  LiquidLine title_line(0, 0, "Parallel");
+  LiquidLine level_line(0, 1, "Level: ", level);
+  LiquidScreen screen(title_line, level_line);
+  LiquidMenu menu(driver, screen);
+
+  lcd.begin(16, 2);
+  menu.set_displaySize(16, 2);
+  menu.init();
+  menu.update();
+  CHECK_EQUAL("Parallel        ", display.controller.get_row(0));
+  CHECK_EQUAL("Level: 100      ", display.controller.get_row(1));
+
+  level = 7;
+  menu.softUpdate();
+  CHECK_EQUAL("Level: 7        ", display.controller.get_row(1));
+  CHECK_EQUAL(0, display.busyBytes);
+  host_setPins(nullptr);
+}
+
+int main() {
+  // The waits poll micros(), which takes time on the target.
+  host_setMicrosCost(1);
+  test_noRwPin();
+  test_busyFlag();
+  test_stuckBusyFlag();
+  test_addressCounter();
+  test_menu();
+  return check_result("test_parallel");
+}
@@ -0,0 +1,248 @@
+/**
+@file
+Tests of the PCF8574 backend against the recording `Wire` stand-in.
+
+Checks the exact bytes sent to the PCF8574 (nibbles, enable pulses, RS
+and backlight), how they are split into transmissions and, through a model
+of the backpack, what the display shows.
+*/
+
+#include <LiquidMenu.h>
+#include <LiquidPCF8574.h>
+
+#include "check.h"
+#include "HD44780.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+/// Model of a PCF8574 backpack driving an HD44780.
+/**
+Latches a nibble on the falling edge of the enable output, like the
+controller does, and executes the bytes assembled from the nibbles.
+*/
+class Backpack {
+public:
+  /// Sends the bytes of the recorded transmissions to the controller.
+  void receive(const TwoWire &wire) {
+    for (const TwoWire::Transmission &transmission : wire.transmissions) {
+      for (uint8_t pins : transmission.bytes) {
+        if ((_pins & ENABLE) && !(pins & ENABLE)) {
+          latch(_pins);
+        }
+        _pins = pins;
+      }
+    }
+  }
+
+  HD44780 controller{ 20, 4 }; ///< The display
+
+private:
+  static const uint8_t RS = 0x01;
+  static const uint8_t ENABLE = 0x04;
+
+  /// Latches the nibble of the data outputs.
+  void latch(uint8_t pins) {
+    const uint8_t nibble = pins & 0xF0;
+    if (!_fourBit) {
+      // Every nibble is a whole instruction in 8-bit mode.
+      controller.instruction(nibble);
+      _fourBit = (nibble == 0x20);
+      return;
+    }
+    if (!_lowNibble) {
+      _highNibble = nibble;
+      _lowNibble = true;
+      return;
+    }
+    _lowNibble = false;
+    const uint8_t value = _highNibble | (nibble >> 4);
+    if (pins & RS) {
+      controller.data(value);
+    } else {
+      controller.instruction(value);
+    }
+  }
+
+  uint8_t _pins = 0;
+  bool _fourBit = false;
+  bool _lowNibble = false;
+  uint8_t _highNibble = 0;
+};
+
+/// Returns the sizes of the recorded transmissions.
+static std::vector<uint8_t> transmission_sizes() {
+  std::vector<uint8_t> sizes;
+  for (const TwoWire::Transmission &transmission : Wire.transmissions) {
+    sizes.push_back(transmission.bytes.size());
+  }
+  return sizes;
+}
+
+/// The initialization switches to 4-bit mode and sends the settings.
+static void test_begin() {
+  Wire.reset();
+  LiquidPCF8574 lcd(0x27);
+  lcd.begin(20, 4);
+
+  CHECK_EQUAL(6, Wire.transmissions.size());
+  CHECK_EQUAL(0x27, Wire.transmissions[0].address);
+  // Backlight only, then three times the 8-bit function set and the
+  // switch to 4-bit mode with the first nibble of the function set.
+  CHECK_EQUAL(Bytes({ 0x08 }), Wire.transmissions[0].bytes);
+  CHECK_EQUAL(Bytes({ 0x3C, 0x38 }), Wire.transmissions[1].bytes);
+  CHECK_EQUAL(Bytes({ 0x3C, 0x38 }), Wire.transmissions[2].bytes);
+  CHECK_EQUAL(Bytes({ 0x3C, 0x38 }), Wire.transmissions[3].bytes);
+  CHECK_EQUAL(Bytes({ 0x2C, 0x28,
+                      0x2C, 0x28, 0x8C, 0x88,   // function set 0x28
+                      0x0C, 0x08, 0xCC, 0xC8,   // display on 0x0C
+                      0x0C, 0x08, 0x6C, 0x68 }),// entry mode 0x06
+              Wire.transmissions[4].bytes);
+  CHECK_EQUAL(Bytes({ 0x0C, 0x08, 0x1C, 0x18 }), Wire.transmissions[5].bytes);
+  CHECK_EQUAL(0, Wire.overflows);
+  CHECK_EQUAL(0, Wire.nestedTransmissions);
+}
+
+/// A character is sent with the pending cursor position in one transmission.
+static void test_write() {
+  LiquidPCF8574 lcd(0x27);
+  lcd.begin(20, 4);
+  Wire.reset();
+
+  lcd.setCursor(0, 1);
+  CHECK_EQUAL(0, Wire.transmissions.size());
+  lcd.write('A');
+  CHECK_EQUAL(1, Wire.transmissions.size());
+  CHECK_EQUAL(Bytes({ 0xCC, 0xC8, 0x0C, 0x08,   // set address 0x40
+                      0x09,                     // RS high
+                      0x4D, 0x49, 0x1D, 0x19 }),// 'A' 0x41
+              Wire.transmissions[0].bytes);
+
+  // RS stays high between the characters.
+  Wire.reset();
+  lcd.write('B');
+  CHECK_EQUAL(Bytes({ 0x4D, 0x49, 0x2D, 0x29 }), Wire.transmissions[0].bytes);
+}
+
+/// Clearing goes low on RS first and waits for the display.
+static void test_clear() {
+  LiquidPCF8574 lcd(0x27);
+  lcd.begin(20, 4);
+  lcd.write('A');
+  Wire.reset();
+
+  const uint32_t start = micros();
+  lcd.clear();
+  CHECK_EQUAL(1, Wire.transmissions.size());
+  CHECK_EQUAL(Bytes({ 0x08, 0x0C, 0x08, 0x1C, 0x18 }), Wire.transmissions[0].bytes);
+  CHECK(micros() - start >= 2160);
+
+  // A cursor position set before clearing isn't sent after it.
+  lcd.setCursor(5, 0);
+  lcd.clear();
+  Wire.reset();
+  lcd.write('C');
+  CHECK_EQUAL(Bytes({ 0x09, 0x4D, 0x49, 0x3D, 0x39 }), Wire.transmissions[0].bytes);
+}
+
+/// A glyph is sent in bursts which fit the buffer.
+static void test_createChar() {
+  LiquidPCF8574 lcd(0x27);
+  lcd.begin(20, 4);
+  Wire.reset();
+
+  uint8_t glyph[8] = { 0x00, 0x0A, 0x1F, 0x1F, 0x0E, 0x04, 0x00, 0x1F };
+  lcd.createChar(1, glyph);
+  // Set CGRAM address 0x48 (4 bytes), RS high (1) and 8 rows (32).
+  CHECK_EQUAL(std::vector<uint8_t>({ 29, 8 }), transmission_sizes());
+  CHECK_EQUAL(Bytes({ 0x4C, 0x48, 0x8C, 0x88, 0x09,
+                      0x0D, 0x09, 0x0D, 0x09,
+                      0x0D, 0x09, 0xAD, 0xA9 }),
+              Bytes(Wire.transmissions[0].bytes.begin(),
+                    Wire.transmissions[0].bytes.begin() + 13));
+  CHECK_EQUAL(Bytes({ 0x0D, 0x09, 0x0D, 0x09, 0x1D, 0x19, 0xFD, 0xF9 }),
+              Wire.transmissions[1].bytes);
+  CHECK_EQUAL(0, Wire.overflows);
+}
+
+/// A run written through a driver is sent in as few transmissions as fit.
+static void test_writeAt() {
+  LiquidPCF8574 lcd(0x27);
+  lcd.begin(20, 4);
+  auto driver = make_liquidDriver(lcd);
+  Wire.reset();
+
+  const char text[] = "LiquidMenu PCF8574!!";
+  driver.write_at(0, 2, (const uint8_t*)text, 20);
+  // The cursor (4) and RS (1) then 4 bytes per character, a transmission
+  // ends when the next character doesn't fit in 32 bytes.
+  CHECK_EQUAL(std::vector<uint8_t>({ 29, 28, 28 }), transmission_sizes());
+  CHECK_EQUAL(85, Wire.get_byteCount());
+  CHECK_EQUAL(Bytes({ 0x9C, 0x98, 0x4C, 0x48 }),   // set address 0x14
+              Bytes(Wire.transmissions[0].bytes.begin(),
+                    Wire.transmissions[0].bytes.begin() + 4));
+  CHECK_EQUAL(0, Wire.overflows);
+
+  // LiquidCrystal_I2C sends three one byte transmissions per nibble, six
+  // per byte, the target is at least three times less bus time.
+  const size_t libraryBits = 21 * 6 * (2 + 9 + 9);
+  CHECK(Wire.get_bitCount() * 3 <= libraryBits);
+}
+
+/// The backlight is kept in every byte and switched alone.
+static void test_backlight() {
+  LiquidPCF8574 lcd(0x27);
+  lcd.begin(16, 2);
+  Wire.reset();
+
+  // The other outputs keep their levels, the last nibble of the clear.
+  lcd.noBacklight();
+  CHECK_EQUAL(Bytes({ 0x10 }), Wire.transmissions[0].bytes);
+  lcd.write('A');
+  CHECK_EQUAL(Bytes({ 0x01, 0x45, 0x41, 0x15, 0x11 }), Wire.transmissions[1].bytes);
+  lcd.backlight();
+  CHECK_EQUAL(Bytes({ 0x19 }), Wire.transmissions[2].bytes);
+}
+
+/// A menu drawn through the backend is shown on the display.
+static void test_menu() {
+  Wire.reset();
+  LiquidPCF8574 lcd(0x27);
+  auto driver = make_liquidDriver(lcd);
+
+  uint16_t value = 1234;
+  LiquidLine title_line(0, 0, "PCF8574 backend");
+  LiquidLine value_line(2, 3, "Value: ", value);
+  LiquidScreen screen(title_line, value_line);
+  LiquidMenu menu(driver, screen);
+
+  lcd.begin(20, 4);
+  menu.set_displaySize(20, 4);
+  menu.init();
+  menu.update();
+
+  Backpack backpack;
+  backpack.receive(Wire);
+  CHECK_EQUAL("PCF8574 backend     ", backpack.controller.get_row(0));
+  CHECK_EQUAL("                    ", backpack.controller.get_row(1));
+  CHECK_EQUAL("  Value: 1234       ", backpack.controller.get_row(3));
+  CHECK_EQUAL(0, Wire.overflows);
+
+  Wire.reset();
+  value = 99;
+  menu.softUpdate();
+  backpack.receive(Wire);
+  CHECK_EQUAL("  Value: 99         ", backpack.controller.get_row(3));
+  CHECK_EQUAL(0, Wire.overflows);
+  CHECK_EQUAL(0, Wire.nestedTransmissions);
+}
+
+int main() {
+  test_begin();
+  test_write();
+  test_clear();
+  test_createChar();
+  test_writeAt();
+  test_backlight();
+  test_menu();
+  return check_result("test_pcf8574");
+}
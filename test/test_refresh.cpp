@@ -0,0 +1,142 @@
+/**
+@file
+Tests of the refresh periods redrawn by `LiquidMenu::tick()`.
+
+A line is due when the time passed to `tick()` crosses a multiple of its
+period. The tests check which lines are redrawn and when the next redraw
+is due, that a screen which became current starts counting again, that
+the rollover of `millis()` doesn't stop the redraws and that the lines of
+a flash screen aren't redrawn.
+*/
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+#include "check.h"
+
+LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
+
+uint8_t fast = 1;
+uint8_t slow = 2;
+uint8_t other = 3;
+
+LiquidLine fast_line(0, 0, "Fast: ", fast);
+LiquidLine slow_line(0, 1, "Slow: ", slow);
+LiquidScreen periods_screen(fast_line, slow_line);
+
+LiquidLine other_line(0, 0, "Other: ", other);
+LiquidScreen other_screen(other_line);
+
+uint8_t flash = 4;
+const char flash_text[] PROGMEM = "Flash: ";
+constexpr LiquidVariableDef flash_variables[] PROGMEM = {
+  as_progmem(flash_text), flash
+};
+constexpr LiquidLineDef flash_lines[] PROGMEM = {
+  make_liquidLineDef(0, 0, flash_variables),
+};
+LiquidFlashScreen flash_screen(flash_lines);
+
+LiquidMenu menu(lcd, periods_screen, other_screen, flash_screen);
+
+/// Changes the values and redraws the current screen.
+static void reset_values() {
+  fast = 1;
+  slow = 2;
+  other = 3;
+  flash = 4;
+  menu.update();
+}
+
+/// The lines are redrawn at the multiples of their periods.
+static void test_multiples() {
+  CHECK(fast_line.set_refreshPeriod(300));
+  CHECK(slow_line.set_refreshPeriod(500));
+  menu.change_screen(&periods_screen);
+  reset_values();
+
+  // The first tick only starts counting, the next redraw is the fast
+  // line's at 1200.
+  CHECK_EQUAL(1200, menu.tick(1000));
+  fast = 11;
+  slow = 12;
+  CHECK_EQUAL(1200, menu.tick(1199));
+  CHECK_EQUAL("Fast: 1         ", lcd.controller.get_row(0));
+
+  CHECK_EQUAL(1500, menu.tick(1200));
+  CHECK_EQUAL("Fast: 11        ", lcd.controller.get_row(0));
+  CHECK_EQUAL("Slow: 2         ", lcd.controller.get_row(1));
+
+  // Both multiples were crossed since the last tick.
+  CHECK_EQUAL(1800, menu.tick(1610));
+  CHECK_EQUAL("Slow: 12        ", lcd.controller.get_row(1));
+
+  // Without periods the next call is due 65535 ms later.
+  CHECK(fast_line.set_refreshPeriod(0));
+  CHECK(slow_line.set_refreshPeriod(0));
+  CHECK_EQUAL(1700 + 0xFFFF, menu.tick(1700));
+}
+
+/// A screen which became current starts counting again.
+static void test_rearm() {
+  CHECK(fast_line.set_refreshPeriod(300));
+  menu.change_screen(&periods_screen);
+  reset_values();
+  menu.tick(1000);
+
+  menu.change_screen(&other_screen);
+  menu.change_screen(&periods_screen);
+  fast = 21;
+  // A long time later, the screen was drawn whole by the change.
+  menu.tick(9000);
+  CHECK_EQUAL("Fast: 1         ", lcd.controller.get_row(0));
+  menu.tick(9300);
+  CHECK_EQUAL("Fast: 21        ", lcd.controller.get_row(0));
+  CHECK(fast_line.set_refreshPeriod(0));
+}
+
+/// The redraws go on across the rollover of `millis()`.
+static void test_rollover() {
+  CHECK(fast_line.set_refreshPeriod(100));
+  menu.change_screen(&periods_screen);
+  reset_values();
+  menu.tick(0xFFFFFFF0);
+  fast = 31;
+  menu.tick(0x10);
+  CHECK_EQUAL("Fast: 31        ", lcd.controller.get_row(0));
+  CHECK(fast_line.set_refreshPeriod(0));
+}
+
+/// A period takes one slot, which is given back with the line.
+static void test_slots() {
+  const uint8_t freeSlots = LiquidLineBase::get_freeSlots();
+  {
+    LiquidLine line(0, 0, "Line");
+    CHECK_EQUAL(freeSlots - 1, LiquidLineBase::get_freeSlots());
+    CHECK(line.set_refreshPeriod(100));
+    CHECK(line.set_refreshPeriod(200));
+    CHECK_EQUAL(freeSlots - 2, LiquidLineBase::get_freeSlots());
+  }
+  CHECK_EQUAL(freeSlots, LiquidLineBase::get_freeSlots());
+}
+
+/// The lines of a flash screen have no periods.
+static void test_flashScreen() {
+  menu.change_screen(&flash_screen);
+  reset_values();
+  menu.tick(1000);
+  flash = 41;
+  CHECK_EQUAL(5000 + 0xFFFF, menu.tick(5000));
+  CHECK_EQUAL("Flash: 4        ", lcd.controller.get_row(0));
+}
+
+int main() {
+  lcd.begin(16, 2);
+  menu.init();
+  test_multiples();
+  test_rearm();
+  test_rollover();
+  test_slots();
+  test_flashScreen();
+  return check_result("test_refresh");
+}
@@ -0,0 +1,96 @@
+/**
+@file
+Tests of menus sharing a display.
+
+The menus built for the same display share what it shows, so a menu
+changed to with `LiquidSystem::change_menu()` sends only the characters
+that differ. What the display shows is handed over to the next menu when
+the menu holding it is gone, and the menus built for other displays draw
+on their own. A display larger than the frame is reported.
+*/
+
+#include <new>
+#include <string.h>
+
+#include <LiquidCrystal.h>
+#include <LiquidMenu.h>
+
+#include "check.h"
+
+LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
+LiquidCrystal other_lcd(12, 10, 5, 4, 3, 2);
+
+uint8_t firstLevel = 10;
+uint8_t secondLevel = 20;
+
+LiquidLine first_line(0, 0, "Level: ", firstLevel);
+LiquidScreen first_screen(first_line);
+
+LiquidLine second_line(0, 0, "Level: ", secondLevel);
+LiquidScreen second_screen(second_line);
+
+/// The storage of the first menu, which is destroyed by the test.
+alignas(LiquidMenu) uint8_t first_storage[sizeof(LiquidMenu)];
+
+/// The changed to menu sends only the changed characters and keeps
+/// drawing when the other menu is gone.
+static void test_changeMenu() {
+  LiquidMenu *p_firstMenu = new (first_storage) LiquidMenu(lcd, first_screen);
+  LiquidMenu second_menu(lcd, second_screen);
+  LiquidSystem system(*p_firstMenu, second_menu);
+  CHECK(system.set_displaySize(16, 2));
+  system.set_clearOnUpdate(false);
+  system.update();
+  CHECK_EQUAL("Level: 10       ", lcd.controller.get_row(0));
+
+  lcd.controller.reset_counters();
+  CHECK(system.change_menu(second_menu));
+  CHECK_EQUAL("Level: 20       ", lcd.controller.get_row(0));
+  CHECK_EQUAL(1, lcd.controller.get_counters().characters);
+
+  p_firstMenu->~LiquidMenu();
+  memset(first_storage, 0, sizeof(first_storage));
+  secondLevel = 30;
+  lcd.controller.reset_counters();
+  second_menu.softUpdate();
+  CHECK_EQUAL("Level: 30       ", lcd.controller.get_row(0));
+  CHECK_EQUAL(1, lcd.controller.get_counters().characters);
+}
+
+/// Menus built for different displays draw on their own.
+static void test_twoDisplays() {
+  LiquidMenu first_menu(lcd, first_screen);
+  LiquidMenu other_menu(other_lcd, second_screen);
+  first_menu.set_clearOnUpdate(false);
+  other_menu.set_clearOnUpdate(false);
+  lcd.clear();
+  other_lcd.clear();
+  first_menu.update();
+  other_menu.update();
+  CHECK_EQUAL("Level: 10       ", lcd.controller.get_row(0));
+  CHECK_EQUAL("Level: 30       ", other_lcd.controller.get_row(0));
+
+  // A display of another type through a driver, the menu built for the
+  // driver doesn't share the display of the menu built for the object.
+  auto other_driver = make_liquidDriver(other_lcd);
+  LiquidMenu driver_menu(other_driver, first_screen);
+  driver_menu.set_clearOnUpdate(false);
+  driver_menu.update();
+  CHECK_EQUAL("Level: 10       ", other_lcd.controller.get_row(0));
+}
+
+/// A display larger than the frame is reported.
+static void test_displaySize() {
+  LiquidMenu menu(lcd, first_screen);
+  CHECK(!menu.set_displaySize(MAX_COLUMNS + 20, 2));
+  CHECK(menu.set_displaySize(MAX_COLUMNS, MAX_ROWS));
+}
+
+int main() {
+  lcd.begin(16, 2);
+  other_lcd.begin(16, 2);
+  test_changeMenu();
+  test_twoDisplays();
+  test_displaySize();
+  return check_result("test_system");
+}